@@ -15,30 +15,34 @@
 #include <zephyr/drivers/display.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <errno.h>
 #include <string.h>
 
-#include "qr_32x32.h"
+#include "display/ch1115.h"
+#include "simple_ui_render.h"
+#include "src/audio_meter.h"
 
 LOG_MODULE_REGISTER(simple_ui, LOG_LEVEL_INF);
 
-#define OLED_WIDTH  88
-#define OLED_HEIGHT 48
-#define OLED_BUF_SIZE (OLED_WIDTH * OLED_HEIGHT / 8)
-
 /*
- * 如果你的屏幕显示是“左右镜像/上下镜像”，可以在这里用软件方式修正。
+ * 如果你的屏幕显示是“左右镜像/上下镜像”，可以在这里修正。
  * 默认开启X方向镜像（常见于SSD1306/SH1106的段映射方向与期望相反）。
  * 如果你的屏幕本来就正常，把 UI_MIRROR_X 改成 0。
+ * 镜像由驱动用段重映射/COM扫描方向在硬件上完成（ch1115_set_mirror），
+ * 绘图代码始终使用自然坐标，没有逐像素变换开销。
  */
 #define UI_MIRROR_X 1
 #define UI_MIRROR_Y 0
 
-/* 场景枚举（按需求仅保留两页：INFO 与 RECORD） */
-enum ui_scene {
-    SCENE_INFO,
-    SCENE_START_RECORDING,
-    SCENE_QR,
-};
+/* 演示页面切换周期与录音页滚动节拍 */
+#define REC_PAGE_SWITCH_MS      10000
+#define REC_SCROLL_TICK_MS      10
+/*
+ * 电平显示的最短保持时间。音量一变录音页就要整帧重画，保持期内只记下最大峰值、
+ * 到期再换上，增量渲染和按列补发才跑得起来（电平块每 10ms 一个，见
+ * CONFIG_RESPEAKER_AUDIO_METER_SIM_BLOCK_MS）。
+ */
+#define REC_VOLUME_HOLD_MS      100
 
 /* 简单UI状态（不包含LVGL对象指针，节省大量RAM） */
 struct simple_ui {
@@ -57,495 +61,344 @@ static struct simple_ui g_ui = {
     .volume = 50,
 };
 
-/* 帧缓冲区（仅528字节） */
-static uint8_t frame_buf[OLED_BUF_SIZE];
-
-/* ========================================
- * 像素操作辅助函数
- * ======================================== */
+/* 电平峰值保持：peak 为保持期内到达的最大峰值 */
+static struct {
+    uint16_t peak;
+    bool pending;
+    uint32_t shown_ms;
+} meter_hold;
 
-/**
- * @brief 设置单个像素
- */
-static inline void map_xy(int *x, int *y)
+/* 帧缓冲区（仅528字节） */
+static struct ui_frame frame;
+/* 屏幕当前内容（最近一次写入/滚动后的帧），用于只发送变化的列 */
+static uint8_t shown_buf[OLED_BUF_SIZE];
+/* shown_buf 是否与屏幕一致；上电或写失败后为 false，下一帧整帧写 */
+static bool shown_valid;
+
+#ifdef CONFIG_RESPEAKER_SIMPLE_UI_RENDER_STATS
+/* 每个场景的渲染耗时（CPU周期），切换场景时打印并清零 */
+static struct {
+    uint32_t frames;
+    uint32_t max_cyc;
+    uint64_t sum_cyc;
+    uint32_t sent_frames; /* 送显次数（含无变化、0字节的帧） */
+    uint32_t sent_bytes;  /* 驱动实际送上总线的 GDDRAM 字节数 */
+} render_stats[SCENE_COUNT];
+/* 上一帧结束时驱动的 stats.bytes_sent */
+static uint32_t bus_bytes_last;
+
+static inline uint32_t render_stats_begin(void)
 {
-    if (UI_MIRROR_X) {
-        *x = (OLED_WIDTH - 1) - *x;
-    }
-    if (UI_MIRROR_Y) {
-        *y = (OLED_HEIGHT - 1) - *y;
-    }
+    return k_cycle_get_32();
 }
 
-static inline void set_pixel(uint8_t *buf, int x, int y)
+static void render_stats_end(uint32_t t0)
 {
-    map_xy(&x, &y);
-    if (x < 0 || x >= OLED_WIDTH || y < 0 || y >= OLED_HEIGHT)
-        return;
-    buf[(y / 8) * OLED_WIDTH + x] |= (1 << (y % 8));
+    uint32_t cyc = k_cycle_get_32() - t0;
+
+    render_stats[g_ui.scene].frames++;
+    render_stats[g_ui.scene].sum_cyc += cyc;
+    render_stats[g_ui.scene].max_cyc = MAX(render_stats[g_ui.scene].max_cyc, cyc);
 }
 
-/**
- * @brief 清除单个像素
+/*
+ * 按驱动 stats.bytes_sent 的帧间差计字节：分页合并、整帧回退和挂起回放
+ * 都以驱动实际发出的为准。定帧间隔下本帧的数据可能在下一帧才发出，
+ * 计到下一帧，场景平均值不受影响。
  */
-static inline void clear_pixel(uint8_t *buf, int x, int y)
+static void bus_stats_frame(void)
 {
-    map_xy(&x, &y);
-    if (x < 0 || x >= OLED_WIDTH || y < 0 || y >= OLED_HEIGHT)
-        return;
-    buf[(y / 8) * OLED_WIDTH + x] &= ~(1 << (y % 8));
+    struct ch1115_stats st;
+
+    ch1115_get_stats(display, &st);
+    render_stats[g_ui.scene].sent_frames++;
+    render_stats[g_ui.scene].sent_bytes += st.bytes_sent - bus_bytes_last;
+    bus_bytes_last = st.bytes_sent;
 }
 
-/**
- * @brief 绘制矩形
- */
-static void draw_rect(uint8_t *buf, int x, int y, int w, int h, bool fill)
+static void render_stats_report(enum ui_scene s)
 {
-    for (int i = x; i < x + w && i < OLED_WIDTH; i++) {
-        for (int j = y; j < y + h && j < OLED_HEIGHT; j++) {
-            if (fill || i == x || i == x + w - 1 || j == y || j == y + h - 1) {
-                set_pixel(buf, i, j);
-            }
-        }
+    if (render_stats[s].frames == 0u) {
+        return;
     }
-}
 
-/* ========================================
- * INFO页面图标（极简像素风）
- * ======================================== */
+    uint32_t avg = (uint32_t)(render_stats[s].sum_cyc / render_stats[s].frames);
 
-static void draw_battery_full_icon(uint8_t *buf, int x, int y)
-{
-    /* 14x10 battery outline + cap */
-    draw_rect(buf, x, y + 1, 12, 8, false);
-    draw_rect(buf, x + 12, y + 3, 2, 4, true);
-    /* fill */
-    draw_rect(buf, x + 2, y + 3, 8, 4, true);
+    LOG_INF("scene %d render: %u frames, avg %u cyc (%u us), max %u cyc", s,
+            render_stats[s].frames, avg, k_cyc_to_us_floor32(avg), render_stats[s].max_cyc);
+    if (render_stats[s].sent_frames > 0u) {
+        LOG_INF("scene %d bus: %u frames, %u B/frame (full frame %u B)", s,
+                render_stats[s].sent_frames,
+                render_stats[s].sent_bytes / render_stats[s].sent_frames, OLED_BUF_SIZE);
+    }
+    memset(&render_stats[s], 0, sizeof(render_stats[s]));
 }
-
-static void draw_wifi_off_icon(uint8_t *buf, int x, int y)
+#else
+static inline uint32_t render_stats_begin(void)
 {
-    /* simple Wi-Fi arcs + slash */
-    /* arcs */
-    for (int i = 0; i < 7; i++) {
-        set_pixel(buf, x + 6 - i, y + 6 - (i / 2));
-        set_pixel(buf, x + 6 + i, y + 6 - (i / 2));
-    }
-    for (int i = 0; i < 5; i++) {
-        set_pixel(buf, x + 6 - i, y + 8 - (i / 2));
-        set_pixel(buf, x + 6 + i, y + 8 - (i / 2));
-    }
-    /* dot */
-    set_pixel(buf, x + 6, y + 10);
-    /* slash */
-    for (int i = 0; i < 12; i++) {
-        set_pixel(buf, x + 1 + i, y + 11 - i);
-    }
+    return 0;
 }
 
-static void draw_recording_icon(uint8_t *buf, int x, int y)
+static inline void render_stats_end(uint32_t t0)
 {
-    /* 10x10 ring + center dot */
-    draw_rect(buf, x + 1, y + 1, 10, 10, false);
-    draw_rect(buf, x + 4, y + 4, 4, 4, true);
+    ARG_UNUSED(t0);
 }
 
-static void draw_audio_tx_icon(uint8_t *buf, int x, int y)
+static inline void bus_stats_frame(void)
 {
-    /* speaker */
-    draw_rect(buf, x + 1, y + 4, 3, 4, true);
-    set_pixel(buf, x + 4, y + 3);
-    set_pixel(buf, x + 4, y + 8);
-    set_pixel(buf, x + 5, y + 2);
-    set_pixel(buf, x + 5, y + 9);
-    /* arrow */
-    for (int i = 0; i < 6; i++) {
-        set_pixel(buf, x + 8 + i, y + 6);
-    }
-    set_pixel(buf, x + 12, y + 5);
-    set_pixel(buf, x + 13, y + 4);
-    set_pixel(buf, x + 12, y + 7);
-    set_pixel(buf, x + 13, y + 8);
 }
 
-/* ========================================
- * QR code (scaled to fit OLED height)
- * ======================================== */
-
-/* Quiet zone around the QR, in modules. Smaller saves space; too small hurts scanning.
- * On this tiny OLED, 1 module works well when modules are 2x2 pixels.
- */
-#define QR_QUIET_MODULES 1
-
-static inline bool qr_module_is_black(int mx, int my)
+static inline void render_stats_report(enum ui_scene s)
 {
-    if (mx < 0 || my < 0 || mx >= QR_MODULES || my >= QR_MODULES) {
-        return false;
-    }
-
-    const int stride = QR_STRIDE_BYTES;
-    const int byte_index = my * stride + (mx / 8);
-    const int bit_index = 7 - (mx % 8);
-    return ((qr_module_bits[byte_index] >> bit_index) & 0x1) != 0;
+    ARG_UNUSED(s);
 }
+#endif /* CONFIG_RESPEAKER_SIMPLE_UI_RENDER_STATS */
 
-static void draw_qr_scaled_black_bg(uint8_t *buf)
+static void render_scene(void)
 {
-    /* Black background for power saving (OLED off). */
-    /* clear_screen() already did memset(buf, 0), so nothing to do here. */
-
-    const int total_modules = QR_MODULES + 2 * QR_QUIET_MODULES;
-
-    /* Integer scaling for crisp edges.
-     * We also keep a 1px margin to avoid touching the bezel.
-     */
-    const int max_w = OLED_WIDTH - 2;
-    const int max_h = OLED_HEIGHT - 2;
-
-    int scale_w = max_w / total_modules;
-    int scale_h = max_h / total_modules;
-    int scale = (scale_w < scale_h) ? scale_w : scale_h;
-    if (scale < 1) {
-        scale = 1;
-    }
+    uint32_t t0 = render_stats_begin();
 
-    const int qr_px = total_modules * scale;
-    const int x0 = (OLED_WIDTH - qr_px) / 2;
-    const int y0 = (OLED_HEIGHT - qr_px) / 2;
-
-    /* White QR window (quiet zone included), everything else stays black.
-     * This keeps scan reliability while avoiding a full-screen white background.
-     */
-    draw_rect(buf, x0, y0, qr_px, qr_px, true);
+    ui_render_scene(&frame, g_ui.scene, g_ui.volume);
+    render_stats_end(t0);
+}
 
-    const int inner_x0 = x0 + QR_QUIET_MODULES * scale;
-    const int inner_y0 = y0 + QR_QUIET_MODULES * scale;
+/* ========================================
+ * 公开API函数
+ * ======================================== */
 
-    /* Normal polarity inside the white window: black modules = pixels OFF. */
-    for (int my = 0; my < QR_MODULES; my++) {
-        for (int mx = 0; mx < QR_MODULES; mx++) {
-            if (!qr_module_is_black(mx, my)) {
-                continue;
+/**
+ * @brief 只把 frame.buf 中与 shown_buf 不同的 page 带写到屏幕
+ *
+ * 每个page取变化列的 [x0, x1)；相邻的脏page合并成一个带（列范围取并集），
+ * 一个带一次 display_write。shown_buf 无效时整帧写。
+ *
+ * @return 写出的字节数，失败时为负的错误码
+ */
+static int fb_flush_dirty(void)
+{
+    uint8_t x0[OLED_PAGES];
+    uint8_t x1[OLED_PAGES];
+    int bytes = 0;
+
+    for (int p = 0; p < OLED_PAGES; p++) {
+        const uint8_t *f = &frame.buf[p * OLED_WIDTH];
+        const uint8_t *o = &shown_buf[p * OLED_WIDTH];
+        int a = 0;
+        int b = OLED_WIDTH;
+
+        if (shown_valid) {
+            while (a < OLED_WIDTH && f[a] == o[a]) {
+                a++;
             }
-
-            const int px0 = inner_x0 + mx * scale;
-            const int py0 = inner_y0 + my * scale;
-            for (int dy = 0; dy < scale; dy++) {
-                for (int dx = 0; dx < scale; dx++) {
-                    clear_pixel(buf, px0 + dx, py0 + dy);
-                }
+            while (b > a && f[b - 1] == o[b - 1]) {
+                b--;
             }
         }
+        x0[p] = (uint8_t)a;
+        x1[p] = (uint8_t)b;
     }
-}
-
-/* ========================================
- * 录音页面：左滚动“点→对称柱”动画
- * ======================================== */
 
-#define REC_PAGE_SWITCH_MS      10000
-#define REC_SCROLL_TICK_MS      10
+    for (int p = 0; p < OLED_PAGES; ) {
+        if (x0[p] >= x1[p]) {
+            p++;
+            continue;
+        }
 
-/* Demo: randomize volume every N ticks to make the effect obvious */
-#define REC_VOLUME_RAND_TICKS   3
+        int q = p;
+        int bx0 = x0[p];
+        int bx1 = x1[p];
 
-/* Animation tuning knobs */
-#define REC_MAX_HALF_HEIGHT     20
-#define REC_VOLUME_MIN          1
-#define REC_VOLUME_MAX          100
+        while (q + 1 < OLED_PAGES && x0[q + 1] < x1[q + 1]) {
+            q++;
+            bx0 = MIN(bx0, x0[q]);
+            bx1 = MAX(bx1, x1[q]);
+        }
 
-/* Spawned bar base height model: random height + bounded random jitter */
-#define REC_BASE_HALF_MIN       1
-#define REC_HEIGHT_JITTER       3
+        const int pages = q - p + 1;
+        struct display_buffer_descriptor desc = {
+            .buf_size = (pages - 1) * OLED_WIDTH + (bx1 - bx0),
+            .width = (uint16_t)(bx1 - bx0),
+            .height = (uint16_t)(pages * 8),
+            .pitch = OLED_WIDTH,
+        };
+        int ret = display_write(display, (uint16_t)bx0, (uint16_t)(p * 8), &desc,
+                                &frame.buf[p * OLED_WIDTH + bx0]);
+
+        if (ret < 0) {
+            shown_valid = false;
+            return ret;
+        }
 
-/* Dot on the right side: 2x2 = 4 pixels */
-#define REC_DOT_W               2
-#define REC_DOT_H               2
+        /* 带外的列本来就没变，整page复制即可 */
+        memcpy(&shown_buf[p * OLED_WIDTH], &frame.buf[p * OLED_WIDTH],
+               (size_t)pages * OLED_WIDTH);
+        bytes += pages * (bx1 - bx0);
+        p = q + 1;
+    }
 
-/* Bar thickness (in columns): derived from current volume, applied to ALL on-screen bars */
-#define REC_BAR_THICK_MIN       1
-#define REC_BAR_THICK_MAX       3
+    shown_valid = true;
+    return bytes;
+}
 
-/* Deterministic spacing between generated columns ("柱间隔").
- * NOTE: by request, volume does NOT affect this spacing.
+/**
+ * @brief 切换UI场景
+ * @param s 目标场景
  */
-#define REC_SPAWN_GAP            3
+void ui_set_scene(enum ui_scene s)
+{
+    /* 电平表只在录音页运行：进入时启动（模拟）生产者，离开时停止 */
+    if (s == SCENE_START_RECORDING && g_ui.scene != SCENE_START_RECORDING) {
+        meter_hold.peak = 0;
+        meter_hold.pending = false;
+        audio_meter_start();
+    } else if (s != SCENE_START_RECORDING && g_ui.scene == SCENE_START_RECORDING) {
+        audio_meter_stop();
+    }
 
-struct rec_column {
-    uint8_t target_half; /* 0..REC_MAX_HALF_HEIGHT */
-};
+    g_ui.scene = s;
 
-static struct rec_column rec_cols[OLED_WIDTH];
-static uint32_t rec_prng = 0x1234u;
-static uint8_t rec_gap_countdown;
+    render_scene();
 
-static uint32_t prng_next(void)
-{
-    /* xorshift32 */
-    uint32_t x = rec_prng;
-    x ^= x << 13;
-    x ^= x >> 17;
-    x ^= x << 5;
-    rec_prng = x ? x : 0x1234u;
-    return rec_prng;
-}
+    int bytes = fb_flush_dirty();
 
-static void rec_anim_init_once(void)
-{
-    static bool inited;
-    if (inited) {
-        return;
-    }
-    inited = true;
-    for (int i = 0; i < OLED_WIDTH; i++) {
-        rec_cols[i].target_half = 0;
+    if (bytes >= 0) {
+        bus_stats_frame();
     }
-    rec_gap_countdown = 0;
+    LOG_DBG("Scene set to: %d", s);
 }
 
-static void rec_anim_step(void)
+/**
+ * @brief 录音页滚动一帧：硬件左移一列，然后只补发内容不同的列
+ *
+ * 模型左移后，新帧与“已滚动的上一帧”只在最右新列、中线处点/柱过渡列
+ * 以及标题所在列上不同；其余列由CH1115滚动引擎直接在GDDRAM中移动。
+ * 只比较增量渲染重画过的列，每段变化列只写其中有变化的page范围。
+ * 屏幕没有滚动引擎（DT无 column-scroll，ch1115_scroll 返回 -ENOTSUP）时，
+ * 照样增量渲染，再按page带只写与屏幕不同的部分。
+ */
+static void ui_scroll_rec_frame(void)
 {
-    /* shift left */
-    memmove(&rec_cols[0], &rec_cols[1], sizeof(rec_cols) - sizeof(rec_cols[0]));
+    uint8_t col_pages[OLED_WIDTH] = { 0 }; /* bit p：该列第p个page有变化 */
+    struct ui_col_span spans[UI_REC_SCROLL_MAX_SPANS];
+    int changed = 0;
 
-    /* By request: spawn gap is constant; volume affects rendering, not generation. */
-    if (rec_gap_countdown > 0) {
-        rec_cols[OLED_WIDTH - 1].target_half = 0;
-        rec_gap_countdown--;
+    if (!shown_valid) {
+        ui_set_scene(g_ui.scene);
         return;
     }
 
-    uint32_t r = prng_next();
-    uint8_t base_half = (uint8_t)(REC_BASE_HALF_MIN + (r % (REC_MAX_HALF_HEIGHT - REC_BASE_HALF_MIN + 1u)));
-    int jitter = (int)((r >> 8) % (2u * REC_HEIGHT_JITTER + 1u)) - (int)REC_HEIGHT_JITTER;
-    int h = (int)base_half + jitter;
-    if (h < 1) {
-        h = 1;
-    } else if (h > REC_MAX_HALF_HEIGHT) {
-        h = REC_MAX_HALF_HEIGHT;
-    }
-
-    rec_cols[OLED_WIDTH - 1].target_half = (uint8_t)h;
-    rec_gap_countdown = REC_SPAWN_GAP;
-}
+    /* 镜像在硬件上完成，GDDRAM列与逻辑x同向，逻辑左移就是硬件左移 */
+    int ret = ch1115_scroll(display, CH1115_SCROLL_LEFT, 0, OLED_HEIGHT);
 
-static void draw_dot_2x2(uint8_t *buf, int x, int y)
-{
-    for (int dx = 0; dx < REC_DOT_W; dx++) {
-        for (int dy = 0; dy < REC_DOT_H; dy++) {
-            set_pixel(buf, x - dx, y + dy);
-        }
-    }
-}
+    if (ret == -ENOTSUP) {
+        uint32_t t0 = render_stats_begin();
 
-static void draw_rec_animation(uint8_t *buf, uint32_t phase)
-{
-    (void)phase;
-    const int x_mid = OLED_WIDTH / 2;
-    const int y_mid = OLED_HEIGHT / 2;
-
-    uint8_t vol = g_ui.volume;
-    if (vol < REC_VOLUME_MIN) {
-        vol = REC_VOLUME_MIN;
-    } else if (vol > REC_VOLUME_MAX) {
-        vol = REC_VOLUME_MAX;
-    }
+        (void)ui_render_rec_scroll(&frame, g_ui.volume, spans);
+        render_stats_end(t0);
 
-    int bar_thick = (int)REC_BAR_THICK_MIN;
-    if (REC_BAR_THICK_MAX > REC_BAR_THICK_MIN) {
-        bar_thick = (int)REC_BAR_THICK_MIN +
-                    (int)(((uint32_t)(vol - 1) * (REC_BAR_THICK_MAX - REC_BAR_THICK_MIN)) / (REC_VOLUME_MAX - 1));
+        if (fb_flush_dirty() >= 0) {
+            bus_stats_frame();
+        }
+        return;
     }
-    if (bar_thick < REC_BAR_THICK_MIN) {
-        bar_thick = REC_BAR_THICK_MIN;
-    } else if (bar_thick > REC_BAR_THICK_MAX) {
-        bar_thick = REC_BAR_THICK_MAX;
+    if (ret < 0) {
+        ui_set_scene(g_ui.scene);
+        return;
     }
 
-    for (int x = 0; x < OLED_WIDTH; x++) {
-        const struct rec_column *c = &rec_cols[x];
-        if (c->target_half == 0) {
-            continue;
-        }
-
-        if (x > x_mid) {
-            /* dot mode (right half): fixed 2x2 dot, no vertical jitter */
-            int dot_y = y_mid - 1;
-            if (dot_y < 0) {
-                dot_y = 0;
-            }
-            draw_dot_2x2(buf, x, dot_y);
-        } else {
-            /* bar mode (left half): height+width scale with current volume */
-            int cur_half = (int)(((uint32_t)c->target_half * (uint32_t)vol + (REC_VOLUME_MAX - 1u)) / REC_VOLUME_MAX);
-            if (cur_half > REC_MAX_HALF_HEIGHT) {
-                cur_half = REC_MAX_HALF_HEIGHT;
-            }
-            if (cur_half < 1) {
-                cur_half = 1;
-            }
+    for (int page = 0; page < OLED_PAGES; page++) {
+        uint8_t *row = &shown_buf[page * OLED_WIDTH];
+        uint8_t tmp = row[0];
 
-            for (int dx = 0; dx < bar_thick; dx++) {
-                int xb = x - dx;
-                if (xb < 0) {
-                    continue;
-                }
-                for (int dy = 0; dy <= cur_half; dy++) {
-                    set_pixel(buf, xb, y_mid - dy);
-                    set_pixel(buf, xb, y_mid + dy);
-                }
-            }
-        }
+        memmove(&row[0], &row[1], OLED_WIDTH - 1);
+        row[OLED_WIDTH - 1] = tmp;
     }
-}
 
-/* ========================================
- * 字符绘制（简化5x7字体）
- * ======================================== */
+    /* 段外的列就是上一帧左移一列，与滚动后的屏幕内容相同 */
+    uint32_t t0 = render_stats_begin();
+    const int nspans = ui_render_rec_scroll(&frame, g_ui.volume, spans);
 
-/**
- * @brief 简单的5x7字体数据
- * 仅支持数字、冒号和部分字母
- */
-static const struct {
-    char c;
-    uint8_t data[5];
-} simple_font[] = {
-    {'0', {0x3E, 0x51, 0x49, 0x45, 0x3E}},
-    {'1', {0x00, 0x42, 0x7F, 0x40, 0x00}},
-    {'2', {0x42, 0x61, 0x51, 0x49, 0x46}},
-    {'3', {0x21, 0x41, 0x45, 0x4B, 0x31}},
-    {'4', {0x18, 0x14, 0x12, 0x7F, 0x10}},
-    {'5', {0x27, 0x45, 0x45, 0x45, 0x39}},
-    {'6', {0x3C, 0x4A, 0x49, 0x49, 0x30}},
-    {'7', {0x01, 0x71, 0x09, 0x05, 0x03}},
-    {'8', {0x36, 0x49, 0x49, 0x49, 0x36}},
-    {'9', {0x06, 0x49, 0x49, 0x29, 0x1E}},
-    {':', {0x00, 0x36, 0x00, 0x36, 0x00}},
-    {'A', {0x7E, 0x09, 0x09, 0x09, 0x7E}},
-    {'D', {0x3E, 0x41, 0x41, 0x41, 0x3E}},
-    {'E', {0x7F, 0x49, 0x49, 0x49, 0x41}},
-    {'I', {0x41, 0x41, 0x7F, 0x41, 0x41}},
-    {'K', {0x41, 0x49, 0x49, 0x31, 0x01}},
-    {'M', {0x7F, 0x01, 0x01, 0x01, 0x7F}},
-    {'N', {0x7F, 0x04, 0x08, 0x10, 0x7F}},
-    {'O', {0x3E, 0x41, 0x41, 0x41, 0x3E}},
-    {'R', {0x7F, 0x09, 0x19, 0x29, 0x46}},
-    {'T', {0x01, 0x01, 0x7F, 0x01, 0x01}},
-    {'U', {0x3E, 0x40, 0x40, 0x40, 0x3E}},
-    {'W', {0x3F, 0x40, 0x38, 0x40, 0x3F}},
-    {' ', {0x00, 0x00, 0x00, 0x00, 0x00}},
-};
+    render_stats_end(t0);
 
-/**
- * @brief 绘制单个字符
- */
-static void draw_char(uint8_t *buf, char c, int x, int y)
-{
-    for (size_t i = 0; i < ARRAY_SIZE(simple_font); i++) {
-        if (simple_font[i].c == c) {
-            for (int col = 0; col < 5; col++) {
-                for (int row = 0; row < 7; row++) {
-                    if (simple_font[i].data[col] & (1 << (6 - row))) {
-                        set_pixel(buf, x + col, y + row);
-                    }
+    for (int i = 0; i < nspans; i++) {
+        for (int x = spans[i].x0; x < spans[i].x1; x++) {
+            uint8_t m = 0;
+
+            for (int page = 0; page < OLED_PAGES; page++) {
+                if (frame.buf[page * OLED_WIDTH + x] != shown_buf[page * OLED_WIDTH + x]) {
+                    m |= (uint8_t)(1u << page);
                 }
             }
-            return;
+            col_pages[x] = m;
+            changed += (m != 0u);
         }
     }
-}
 
-/**
- * @brief 绘制字符串
- */
-static void draw_string(uint8_t *buf, const char *str, int x, int y)
-{
-    int pos = x;
-    while (*str && pos < OLED_WIDTH - 5) {
-        draw_char(buf, *str, pos, y);
-        pos += 6;  /* 字符宽度(5) + 间距(1) */
-        str++;
+    /* 音量变化时几乎所有柱都变了，此时按page带写更省事务开销 */
+    if (changed > OLED_WIDTH / 2) {
+        if (fb_flush_dirty() >= 0) {
+            bus_stats_frame();
+        }
+        return;
     }
-}
-
-/* ========================================
- * 场景渲染
- * ======================================== */
 
-/**
- * @brief 清屏
- */
-static void clear_screen(uint8_t *buf)
-{
-    memset(buf, 0, OLED_BUF_SIZE);
-}
+    for (int x = 0; x < OLED_WIDTH; ) {
+        if (col_pages[x] == 0u) {
+            x++;
+            continue;
+        }
 
-/**
- * @brief 渲染当前场景到帧缓冲区
- */
-static void render_scene(uint8_t *buf)
-{
-    clear_screen(buf);
-
-    switch (g_ui.scene) {
-        case SCENE_INFO:
-            /* INFO场景：四个状态图标居中显示 */
-        {
-            const int icon_w = 14;
-            const int gap = 6;
-            const int total_w = 4 * icon_w + 3 * gap;
-            const int x0 = (OLED_WIDTH - total_w) / 2;
-            const int y0 = 16;
-
-            draw_string(buf, "INFO", 34, 4);
-
-            draw_battery_full_icon(buf, x0 + 0 * (icon_w + gap), y0);
-            draw_wifi_off_icon(buf,     x0 + 1 * (icon_w + gap), y0);
-            draw_recording_icon(buf,    x0 + 2 * (icon_w + gap), y0);
-            draw_audio_tx_icon(buf,     x0 + 3 * (icon_w + gap), y0);
+        /* 连续变化列为一段，只写这段列里有变化的page范围 */
+        int x1 = x;
+        uint8_t m = 0;
+        while (x1 < OLED_WIDTH && col_pages[x1] != 0u) {
+            m |= col_pages[x1];
+            x1++;
         }
-            break;
-
-        case SCENE_START_RECORDING:
-            /* RECORD场景：标题 + 左滚动对称柱动画 */
-            rec_anim_init_once();
-            draw_string(buf, "REC", 36, 4);
-            draw_rec_animation(buf, 0);
-            break;
-
-        case SCENE_QR:
-        {
-            /* QR场景：尽可能放大（受48px高度限制），黑底 + 局部白底(quiet zone) */
-            draw_qr_scaled_black_bg(buf);
+
+        const int p0 = __builtin_ctz(m);
+        const int p1 = 31 - __builtin_clz(m);
+        const int pages = p1 - p0 + 1;
+        struct display_buffer_descriptor desc = {
+            .buf_size = (pages - 1) * OLED_WIDTH + (x1 - x),
+            .width = (uint16_t)(x1 - x),
+            .height = (uint16_t)(pages * 8),
+            .pitch = OLED_WIDTH,
+        };
+
+        if (display_write(display, (uint16_t)x, (uint16_t)(p0 * 8), &desc,
+                          &frame.buf[p0 * OLED_WIDTH + x]) < 0) {
+            shown_valid = false;
+            ui_set_scene(g_ui.scene);
+            return;
         }
-            break;
+        x = x1;
     }
-}
 
-/* ========================================
- * 公开API函数
- * ======================================== */
+    memcpy(shown_buf, frame.buf, sizeof(shown_buf));
+    bus_stats_frame();
+}
 
 /**
- * @brief 切换UI场景
- * @param s 目标场景
+ * @brief 从电平队列取本 tick 的电平，按峰值保持更新 g_ui.volume
+ * @param now 当前时间（ms）
  */
-void ui_set_scene(enum ui_scene s)
+static void ui_meter_update(uint32_t now)
 {
-    g_ui.scene = s;
-
-    render_scene(frame_buf);
+    struct audio_meter_sample level;
 
-    struct display_buffer_descriptor desc = {
-        .buf_size = OLED_BUF_SIZE,
-        .width = OLED_WIDTH,
-        .height = OLED_HEIGHT,
-        .pitch = OLED_WIDTH,
-    };
+    /* 无锁 SPSC 环形队列：本 tick 内最响的一块 */
+    if (audio_meter_drain(&level)) {
+        meter_hold.peak = MAX(meter_hold.peak, level.peak);
+        meter_hold.pending = true;
+    }
 
-    display_write(display, 0, 0, &desc, frame_buf);
-    LOG_DBG("Scene set to: %d", s);
+    if (meter_hold.pending && (now - meter_hold.shown_ms) >= REC_VOLUME_HOLD_MS) {
+        g_ui.volume = (uint8_t)MAX(audio_meter_level(meter_hold.peak), REC_VOLUME_MIN);
+        meter_hold.peak = 0;
+        meter_hold.pending = false;
+        meter_hold.shown_ms = now;
+    }
 }
 
 /**
@@ -614,6 +467,10 @@ int main(void)
     LOG_INF("Display resolution: %dx%d", OLED_WIDTH, OLED_HEIGHT);
     LOG_INF("Frame buffer size: %u bytes", (unsigned)OLED_BUF_SIZE);
 
+    if (ch1115_set_mirror(display, UI_MIRROR_X, UI_MIRROR_Y) < 0) {
+        LOG_ERR("Failed to set display mirror");
+    }
+
     /* 初始场景 */
     ui_set_scene(SCENE_INFO);
 
@@ -624,7 +481,6 @@ int main(void)
     };
     int scene_idx = 0;
     uint32_t last_switch_ms = k_uptime_get_32();
-    uint32_t rec_tick = 0;
 
     while (1) {
         k_sleep(K_MSEC(REC_SCROLL_TICK_MS));
@@ -633,6 +489,7 @@ int main(void)
         uint32_t now = k_uptime_get_32();
         if ((now - last_switch_ms) >= REC_PAGE_SWITCH_MS) {
             last_switch_ms = now;
+            render_stats_report(g_ui.scene);
             scene_idx = (scene_idx + 1) % ARRAY_SIZE(scenes);
             ui_set_scene(scenes[scene_idx]);
             LOG_INF("Scene switched to: %d", scenes[scene_idx]);
@@ -640,13 +497,9 @@ int main(void)
 
         /* RECORD 页面持续刷新动画 */
         if (g_ui.scene == SCENE_START_RECORDING) {
-            rec_tick++;
-            if ((rec_tick % REC_VOLUME_RAND_TICKS) == 0u) {
-                /* 1..100 random volume */
-                g_ui.volume = (uint8_t)(REC_VOLUME_MIN + (prng_next() % (REC_VOLUME_MAX - REC_VOLUME_MIN + 1)));
-            }
-            rec_anim_step();
-            ui_set_scene(SCENE_START_RECORDING);
+            ui_meter_update(now);
+            ui_rec_anim_step();
+            ui_scroll_rec_frame();
         }
     }
 
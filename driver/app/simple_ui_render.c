@@ -0,0 +1,570 @@
+/*
+ * simple_ui 渲染核心：场景、图标、字体、二维码和录音动画的帧缓冲运算
+ *
+ * 不依赖Zephyr和显示驱动，送显、脏区跟踪和主循环在 simple_ui.c 中。
+ * 主机构建见 driver/tools/simple_ui_host.c。
+ */
+
+#include "simple_ui_render.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "font5x7.h"
+#include "qr_32x32.h"
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/* ========================================
+ * 像素操作辅助函数
+ * ======================================== */
+
+/**
+ * @brief 设置单个像素
+ */
+static inline void set_pixel(uint8_t *buf, int x, int y)
+{
+    if (x < 0 || x >= OLED_WIDTH || y < 0 || y >= OLED_HEIGHT)
+        return;
+    buf[(y / 8) * OLED_WIDTH + x] |= (1 << (y % 8));
+}
+
+/* ========================================
+ * 区间绘制原语（按page整字节/掩码操作，替代逐像素set_pixel）
+ * 帧缓冲为VTILED：page p 第x字节的bit j = 第 8p+j 行
+ * ======================================== */
+
+/* page p 内属于 [y0, y1) 行的位掩码 */
+static inline uint8_t fb_page_mask(int p, int y0, int y1)
+{
+    int lo = MAX(y0 - p * 8, 0);
+    int hi = MIN(y1 - p * 8, 8);
+
+    return (uint8_t)((0xFFu << lo) & (0xFFu >> (8 - hi)));
+}
+
+/**
+ * @brief 填充(set)或清除矩形：每个page一个掩码，整page直接memset
+ */
+static void fb_fill_rect(uint8_t *buf, int x, int y, int w, int h, bool set)
+{
+    const int x0 = MAX(x, 0);
+    const int x1 = MIN(x + w, OLED_WIDTH);
+    const int y0 = MAX(y, 0);
+    const int y1 = MIN(y + h, OLED_HEIGHT);
+
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    for (int p = y0 / 8; p <= (y1 - 1) / 8; p++) {
+        uint8_t m = fb_page_mask(p, y0, y1);
+        uint8_t *row = &buf[p * OLED_WIDTH + x0];
+
+        if (m == 0xFFu) {
+            memset(row, set ? 0xFF : 0x00, (size_t)(x1 - x0));
+        } else if (set) {
+            for (int i = 0; i < x1 - x0; i++) {
+                row[i] |= m;
+            }
+        } else {
+            for (int i = 0; i < x1 - x0; i++) {
+                row[i] &= (uint8_t)~m;
+            }
+        }
+    }
+}
+
+/* 竖线 [y0, y1)：每个page一次掩码或整字节写 */
+static inline void fb_vspan(uint8_t *buf, int x, int y0, int y1)
+{
+    fb_fill_rect(buf, x, y0, 1, y1 - y0, true);
+}
+
+/* 横线 [x0, x1)：一个page内的连续字节 */
+static inline void fb_hspan(uint8_t *buf, int x0, int x1, int y)
+{
+    fb_fill_rect(buf, x0, y, x1 - x0, 1, true);
+}
+
+/**
+ * @brief 1bpp位图按整数倍放大贴图（行优先、MSB在左）
+ *
+ * 源图中为1的像素写成 lit（true=点亮，false=熄灭），为0的像素不动。
+ * 每个源列先拼成一个覆盖整屏高度的64位列掩码，再按page一次写入。
+ */
+static void fb_blit_1bpp(uint8_t *buf, int x0, int y0, const uint8_t *src, int stride,
+                         int w, int h, int scale, bool lit)
+{
+    const uint64_t panel_rows = (1ULL << OLED_HEIGHT) - 1ULL;
+    const uint64_t cell = (1ULL << scale) - 1ULL;
+
+    for (int sx = 0; sx < w; sx++) {
+        uint64_t col = 0;
+
+        for (int sy = 0; sy < h; sy++) {
+            int py = y0 + sy * scale;
+
+            if (py < 0 || py >= OLED_HEIGHT) {
+                continue;
+            }
+            if ((src[sy * stride + sx / 8] & (0x80u >> (sx % 8))) != 0u) {
+                col |= cell << py;
+            }
+        }
+        col &= panel_rows;
+        if (col == 0) {
+            continue;
+        }
+
+        for (int dx = 0; dx < scale; dx++) {
+            int x = x0 + sx * scale + dx;
+
+            if (x < 0 || x >= OLED_WIDTH) {
+                continue;
+            }
+            for (int p = 0; p < OLED_HEIGHT / 8; p++) {
+                uint8_t m = (uint8_t)(col >> (8 * p));
+
+                if (lit) {
+                    buf[p * OLED_WIDTH + x] |= m;
+                } else {
+                    buf[p * OLED_WIDTH + x] &= (uint8_t)~m;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 绘制矩形
+ */
+static void draw_rect(uint8_t *buf, int x, int y, int w, int h, bool fill)
+{
+    if (fill) {
+        fb_fill_rect(buf, x, y, w, h, true);
+        return;
+    }
+
+    fb_hspan(buf, x, x + w, y);
+    fb_hspan(buf, x, x + w, y + h - 1);
+    fb_vspan(buf, x, y, y + h);
+    fb_vspan(buf, x + w - 1, y, y + h);
+}
+
+/* ========================================
+ * INFO页面图标（极简像素风）
+ * ======================================== */
+
+static void draw_battery_full_icon(uint8_t *buf, int x, int y)
+{
+    /* 14x10 battery outline + cap */
+    draw_rect(buf, x, y + 1, 12, 8, false);
+    draw_rect(buf, x + 12, y + 3, 2, 4, true);
+    /* fill */
+    draw_rect(buf, x + 2, y + 3, 8, 4, true);
+}
+
+static void draw_wifi_off_icon(uint8_t *buf, int x, int y)
+{
+    /* simple Wi-Fi arcs + slash */
+    /* arcs */
+    for (int i = 0; i < 7; i++) {
+        set_pixel(buf, x + 6 - i, y + 6 - (i / 2));
+        set_pixel(buf, x + 6 + i, y + 6 - (i / 2));
+    }
+    for (int i = 0; i < 5; i++) {
+        set_pixel(buf, x + 6 - i, y + 8 - (i / 2));
+        set_pixel(buf, x + 6 + i, y + 8 - (i / 2));
+    }
+    /* dot */
+    set_pixel(buf, x + 6, y + 10);
+    /* slash */
+    for (int i = 0; i < 12; i++) {
+        set_pixel(buf, x + 1 + i, y + 11 - i);
+    }
+}
+
+static void draw_recording_icon(uint8_t *buf, int x, int y)
+{
+    /* 10x10 ring + center dot */
+    draw_rect(buf, x + 1, y + 1, 10, 10, false);
+    draw_rect(buf, x + 4, y + 4, 4, 4, true);
+}
+
+static void draw_audio_tx_icon(uint8_t *buf, int x, int y)
+{
+    /* speaker */
+    draw_rect(buf, x + 1, y + 4, 3, 4, true);
+    set_pixel(buf, x + 4, y + 3);
+    set_pixel(buf, x + 4, y + 8);
+    set_pixel(buf, x + 5, y + 2);
+    set_pixel(buf, x + 5, y + 9);
+    /* arrow */
+    fb_hspan(buf, x + 8, x + 14, y + 6);
+    set_pixel(buf, x + 12, y + 5);
+    set_pixel(buf, x + 13, y + 4);
+    set_pixel(buf, x + 12, y + 7);
+    set_pixel(buf, x + 13, y + 8);
+}
+
+/* ========================================
+ * QR code (scaled to fit OLED height)
+ * ======================================== */
+
+/* Quiet zone around the QR, in modules. Smaller saves space; too small hurts scanning.
+ * On this tiny OLED, 1 module works well when modules are 2x2 pixels.
+ */
+#define QR_QUIET_MODULES 1
+
+static void draw_qr_scaled_black_bg(uint8_t *buf)
+{
+    /* Black background for power saving (OLED off). */
+    /* clear_screen() already did memset(buf, 0), so nothing to do here. */
+
+    const int total_modules = QR_MODULES + 2 * QR_QUIET_MODULES;
+
+    /* Integer scaling for crisp edges.
+     * We also keep a 1px margin to avoid touching the bezel.
+     */
+    const int max_w = OLED_WIDTH - 2;
+    const int max_h = OLED_HEIGHT - 2;
+
+    int scale_w = max_w / total_modules;
+    int scale_h = max_h / total_modules;
+    int scale = (scale_w < scale_h) ? scale_w : scale_h;
+    if (scale < 1) {
+        scale = 1;
+    }
+
+    const int qr_px = total_modules * scale;
+    const int x0 = (OLED_WIDTH - qr_px) / 2;
+    const int y0 = (OLED_HEIGHT - qr_px) / 2;
+
+    /* White QR window (quiet zone included), everything else stays black.
+     * This keeps scan reliability while avoiding a full-screen white background.
+     */
+    draw_rect(buf, x0, y0, qr_px, qr_px, true);
+
+    const int inner_x0 = x0 + QR_QUIET_MODULES * scale;
+    const int inner_y0 = y0 + QR_QUIET_MODULES * scale;
+
+    /* Normal polarity inside the white window: black modules = pixels OFF. */
+    fb_blit_1bpp(buf, inner_x0, inner_y0, qr_module_bits, QR_STRIDE_BYTES, QR_MODULES,
+                 QR_MODULES, scale, false);
+}
+
+/* ========================================
+ * 录音页面：左滚动“点→对称柱”动画
+ * ======================================== */
+
+/* Animation tuning knobs */
+#define REC_MAX_HALF_HEIGHT     20
+
+/* Spawned bar base height model: random height + bounded random jitter */
+#define REC_BASE_HALF_MIN       1
+#define REC_HEIGHT_JITTER       3
+
+/* Dot on the right side: 2x2 = 4 pixels */
+#define REC_DOT_W               2
+#define REC_DOT_H               2
+
+/* Bar thickness (in columns): derived from current volume, applied to ALL on-screen bars */
+#define REC_BAR_THICK_MIN       1
+#define REC_BAR_THICK_MAX       3
+
+/* Deterministic spacing between generated columns ("柱间隔").
+ * NOTE: by request, volume does NOT affect this spacing.
+ */
+#define REC_SPAWN_GAP            3
+
+/* 标题固定在画面上方，不随动画滚动 */
+#define REC_TITLE               "REC"
+#define REC_TITLE_X             36
+#define REC_TITLE_Y             4
+#define REC_TITLE_W             ((int)(sizeof(REC_TITLE) - 1) * FONT_PITCH)
+
+/* 一列模型最多向左覆盖的屏幕列数（点或柱） */
+#define REC_ITEM_W_MAX          MAX(REC_DOT_W, REC_BAR_THICK_MAX)
+
+struct rec_column {
+    uint8_t target_half; /* 0..REC_MAX_HALF_HEIGHT */
+};
+
+static struct rec_column rec_cols[OLED_WIDTH];
+static uint32_t rec_prng = 0x1234u;
+static uint8_t rec_gap_countdown;
+
+static uint32_t prng_next(void)
+{
+    /* xorshift32 */
+    uint32_t x = rec_prng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rec_prng = x ? x : 0x1234u;
+    return rec_prng;
+}
+
+void ui_rec_anim_reset(void)
+{
+    memset(rec_cols, 0, sizeof(rec_cols));
+    rec_prng = 0x1234u;
+    rec_gap_countdown = 0;
+}
+
+void ui_rec_anim_step(void)
+{
+    /* shift left */
+    memmove(&rec_cols[0], &rec_cols[1], sizeof(rec_cols) - sizeof(rec_cols[0]));
+
+    /* By request: spawn gap is constant; volume affects rendering, not generation. */
+    if (rec_gap_countdown > 0) {
+        rec_cols[OLED_WIDTH - 1].target_half = 0;
+        rec_gap_countdown--;
+        return;
+    }
+
+    uint32_t r = prng_next();
+    uint8_t base_half = (uint8_t)(REC_BASE_HALF_MIN + (r % (REC_MAX_HALF_HEIGHT - REC_BASE_HALF_MIN + 1u)));
+    int jitter = (int)((r >> 8) % (2u * REC_HEIGHT_JITTER + 1u)) - (int)REC_HEIGHT_JITTER;
+    int h = (int)base_half + jitter;
+    if (h < 1) {
+        h = 1;
+    } else if (h > REC_MAX_HALF_HEIGHT) {
+        h = REC_MAX_HALF_HEIGHT;
+    }
+
+    rec_cols[OLED_WIDTH - 1].target_half = (uint8_t)h;
+    rec_gap_countdown = REC_SPAWN_GAP;
+}
+
+static void draw_dot_2x2(uint8_t *buf, int x, int y)
+{
+    /* 向左占 REC_DOT_W 列：x-REC_DOT_W+1 .. x */
+    fb_fill_rect(buf, x - REC_DOT_W + 1, y, REC_DOT_W, REC_DOT_H, true);
+}
+
+static uint8_t rec_volume(uint8_t vol)
+{
+    if (vol < REC_VOLUME_MIN) {
+        vol = REC_VOLUME_MIN;
+    } else if (vol > REC_VOLUME_MAX) {
+        vol = REC_VOLUME_MAX;
+    }
+    return vol;
+}
+
+/**
+ * @brief 绘制覆盖到 [xa, xb) 列的点/柱
+ *
+ * 只做置位，范围外被顺带画到的列若本来就正确则不受影响。
+ */
+static void draw_rec_animation(uint8_t *buf, uint8_t vol, int xa, int xb)
+{
+    const int x_mid = OLED_WIDTH / 2;
+    const int y_mid = OLED_HEIGHT / 2;
+
+    int bar_thick = (int)REC_BAR_THICK_MIN;
+    if (REC_BAR_THICK_MAX > REC_BAR_THICK_MIN) {
+        bar_thick = (int)REC_BAR_THICK_MIN +
+                    (int)(((uint32_t)(vol - 1) * (REC_BAR_THICK_MAX - REC_BAR_THICK_MIN)) / (REC_VOLUME_MAX - 1));
+    }
+    if (bar_thick < REC_BAR_THICK_MIN) {
+        bar_thick = REC_BAR_THICK_MIN;
+    } else if (bar_thick > REC_BAR_THICK_MAX) {
+        bar_thick = REC_BAR_THICK_MAX;
+    }
+
+    const int x_end = MIN(OLED_WIDTH, xb + REC_ITEM_W_MAX - 1);
+
+    for (int x = xa; x < x_end; x++) {
+        const struct rec_column *c = &rec_cols[x];
+        if (c->target_half == 0) {
+            continue;
+        }
+
+        if (x > x_mid) {
+            /* dot mode (right half): fixed 2x2 dot, no vertical jitter */
+            int dot_y = y_mid - 1;
+            if (dot_y < 0) {
+                dot_y = 0;
+            }
+            draw_dot_2x2(buf, x, dot_y);
+        } else {
+            /* bar mode (left half): height+width scale with current volume */
+            int cur_half = (int)(((uint32_t)c->target_half * (uint32_t)vol + (REC_VOLUME_MAX - 1u)) / REC_VOLUME_MAX);
+            if (cur_half > REC_MAX_HALF_HEIGHT) {
+                cur_half = REC_MAX_HALF_HEIGHT;
+            }
+            if (cur_half < 1) {
+                cur_half = 1;
+            }
+
+            /* 柱占 x-bar_thick+1 .. x 列，行 y_mid±cur_half：每个page一次掩码写 */
+            fb_fill_rect(buf, x - bar_thick + 1, y_mid - cur_half, bar_thick,
+                         2 * cur_half + 1, true);
+        }
+    }
+}
+
+/* ========================================
+ * 字符绘制（5x7字体）
+ * ======================================== */
+
+/*
+ * 字模由 tools/gen_font5x7_header.py 在构建时生成，只含界面用到的字符。
+ * 每个字模 FONT5X7_W 字节，bit j = 第j行，与GDDRAM的page字节同一布局。
+ */
+#define FONT_PITCH (FONT5X7_W + 1)  /* 字符宽度(5) + 间距(1) */
+
+/**
+ * @brief 取字符的字模：查一次表，未生成的字符为空白
+ */
+static inline const uint8_t *font_glyph(char c)
+{
+    const unsigned int i = (unsigned int)(unsigned char)c - FONT5X7_FIRST;
+    const uint8_t slot = (i <= FONT5X7_LAST - FONT5X7_FIRST) ? font5x7_index[i] : 0u;
+
+    return &font5x7_glyphs[slot * FONT5X7_W];
+}
+
+/**
+ * @brief 绘制字符串（只置位）
+ *
+ * 字模列直接移位后OR进一个page（y非8对齐时再OR进下一个page），
+ * 每列一到两次整字节写，不逐像素操作。超出屏幕的列被裁掉。
+ */
+static void draw_string(uint8_t *buf, const char *str, int x, int y)
+{
+    if (y <= -8 || y >= OLED_HEIGHT) {
+        return;
+    }
+
+    const int sh = y & 7;
+    const int p = (y - sh) / 8;
+    uint8_t *lo = (p >= 0) ? &buf[p * OLED_WIDTH] : NULL;
+    uint8_t *hi = (sh != 0 && p + 1 < OLED_PAGES) ? &buf[(p + 1) * OLED_WIDTH] : NULL;
+
+    for (; *str && x < OLED_WIDTH; str++, x += FONT_PITCH) {
+        const uint8_t *g = font_glyph(*str);
+
+        for (int col = 0; col < FONT5X7_W; col++) {
+            const int cx = x + col;
+
+            if (cx < 0 || cx >= OLED_WIDTH) {
+                continue;
+            }
+            if (lo) {
+                lo[cx] |= (uint8_t)(g[col] << sh);
+            }
+            if (hi) {
+                hi[cx] |= (uint8_t)(g[col] >> (8 - sh));
+            }
+        }
+    }
+}
+
+/* ========================================
+ * 场景渲染
+ * ======================================== */
+
+/**
+ * @brief 清屏
+ */
+static void clear_screen(uint8_t *buf)
+{
+    memset(buf, 0, OLED_BUF_SIZE);
+}
+
+void ui_render_scene(struct ui_frame *f, enum ui_scene scene, uint8_t volume)
+{
+    uint8_t *buf = f->buf;
+
+    clear_screen(buf);
+    f->rec_volume = 0;
+
+    switch (scene) {
+        case SCENE_INFO:
+            /* INFO场景：四个状态图标居中显示 */
+        {
+            const int icon_w = 14;
+            const int gap = 6;
+            const int total_w = 4 * icon_w + 3 * gap;
+            const int x0 = (OLED_WIDTH - total_w) / 2;
+            const int y0 = 16;
+
+            draw_string(buf, "INFO", 34, 4);
+
+            draw_battery_full_icon(buf, x0 + 0 * (icon_w + gap), y0);
+            draw_wifi_off_icon(buf,     x0 + 1 * (icon_w + gap), y0);
+            draw_recording_icon(buf,    x0 + 2 * (icon_w + gap), y0);
+            draw_audio_tx_icon(buf,     x0 + 3 * (icon_w + gap), y0);
+        }
+            break;
+
+        case SCENE_START_RECORDING:
+            /* RECORD场景：标题 + 左滚动对称柱动画 */
+            draw_string(buf, REC_TITLE, REC_TITLE_X, REC_TITLE_Y);
+            f->rec_volume = rec_volume(volume);
+            draw_rec_animation(buf, f->rec_volume, 0, OLED_WIDTH);
+            break;
+
+        case SCENE_QR:
+        {
+            /* QR场景：尽可能放大（受48px高度限制），黑底 + 局部白底(quiet zone) */
+            draw_qr_scaled_black_bg(buf);
+        }
+            break;
+
+        default:
+            break;
+    }
+}
+
+int ui_render_rec_scroll(struct ui_frame *f, uint8_t volume, struct ui_col_span *spans)
+{
+    const int x_mid = OLED_WIDTH / 2;
+    uint8_t *buf = f->buf;
+    int n = 0;
+
+    if (f->rec_volume != rec_volume(volume)) {
+        ui_render_scene(f, SCENE_START_RECORDING, volume);
+        spans[n++] = (struct ui_col_span){ 0, OLED_WIDTH };
+        return n;
+    }
+
+    for (int page = 0; page < OLED_PAGES; page++) {
+        uint8_t *row = &buf[page * OLED_WIDTH];
+
+        memmove(&row[0], &row[1], OLED_WIDTH - 1);
+        row[OLED_WIDTH - 1] = 0;
+    }
+
+    /* 标题：左移后的旧位置与原位置；过渡列：原来的点与新的柱 */
+    const int tx0 = REC_TITLE_X - 1;
+    const int tx1 = REC_TITLE_X + REC_TITLE_W;
+    const int mx0 = x_mid + 1 - REC_ITEM_W_MAX;
+    const int mx1 = x_mid + 1;
+
+    if (tx1 < mx0 || mx1 < tx0) {
+        spans[n++] = (struct ui_col_span){ (uint8_t)MIN(tx0, mx0), (uint8_t)MIN(tx1, mx1) };
+        spans[n++] = (struct ui_col_span){ (uint8_t)MAX(tx0, mx0), (uint8_t)MAX(tx1, mx1) };
+    } else {
+        spans[n++] = (struct ui_col_span){ (uint8_t)MIN(tx0, mx0), (uint8_t)MAX(tx1, mx1) };
+    }
+    spans[n++] = (struct ui_col_span){ OLED_WIDTH - REC_DOT_W, OLED_WIDTH };
+
+    for (int i = 0; i < n; i++) {
+        fb_fill_rect(buf, spans[i].x0, 0, spans[i].x1 - spans[i].x0, OLED_HEIGHT, false);
+        draw_rec_animation(buf, f->rec_volume, spans[i].x0, spans[i].x1);
+    }
+    draw_string(buf, REC_TITLE, REC_TITLE_X, REC_TITLE_Y);
+
+    return n;
+}
@@ -0,0 +1,79 @@
+#ifndef APP_SIMPLE_UI_RENDER_H
+#define APP_SIMPLE_UI_RENDER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * simple_ui 渲染核心：只做帧缓冲运算，不依赖Zephyr和显示驱动，
+ * 目标板和主机（driver/tools/simple_ui_host.c）编译同一份代码。
+ *
+ * 帧缓冲为VTILED：page p 第x字节的bit j = 第 8p+j 行，与CH1115 GDDRAM一致，
+ * 可以直接交给 display_write()。
+ */
+
+#define OLED_WIDTH  88
+#define OLED_HEIGHT 48
+#define OLED_PAGES  (OLED_HEIGHT / 8)
+#define OLED_BUF_SIZE (OLED_WIDTH * OLED_HEIGHT / 8)
+
+#define REC_VOLUME_MIN 1
+#define REC_VOLUME_MAX 100
+
+/* 场景枚举（按需求仅保留两页：INFO 与 RECORD） */
+enum ui_scene {
+    SCENE_INFO,
+    SCENE_START_RECORDING,
+    SCENE_QR,
+    SCENE_COUNT,
+};
+
+/* 一帧画面，以及画它时录音动画所用的音量（增量渲染据此判断能否沿用） */
+struct ui_frame {
+    uint8_t buf[OLED_BUF_SIZE];
+    uint8_t rec_volume; /* 0 表示 buf 当前不是录音页 */
+};
+
+/* 列段 [x0, x1) */
+struct ui_col_span {
+    uint8_t x0;
+    uint8_t x1;
+};
+
+/* ui_render_rec_scroll() 最多返回的列段数 */
+#define UI_REC_SCROLL_MAX_SPANS 3
+
+/**
+ * @brief 整帧渲染一个场景
+ * @param volume 录音页的音量，超出 REC_VOLUME_MIN..REC_VOLUME_MAX 时取边界
+ */
+void ui_render_scene(struct ui_frame *f, enum ui_scene scene, uint8_t volume);
+
+/**
+ * @brief 录音页滚动一帧的增量渲染：f 整体左移一列，只重画变化的列
+ *
+ * 先调用 ui_rec_anim_step()。模型左移一格后，新帧除以下列外就是上一帧
+ * 左移一列：最右的新列、中线处点变柱的过渡列、以及不随动画滚动的标题。
+ * 这些列清空后重画，其余列不动。音量变了（所有柱高/柱宽都变）或 f 不是
+ * 录音页时整帧重画。
+ *
+ * @param spans 输出：重画过的列段，最多 UI_REC_SCROLL_MAX_SPANS 段
+ * @return 段数；段外的列就是上一帧左移一列
+ */
+int ui_render_rec_scroll(struct ui_frame *f, uint8_t volume, struct ui_col_span *spans);
+
+/* 录音动画模型左移一格，最右按固定间隔生成新柱 */
+void ui_rec_anim_step(void);
+
+/* 清空录音动画模型并复位随机数种子，之后的序列可复现 */
+void ui_rec_anim_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_SIMPLE_UI_RENDER_H */
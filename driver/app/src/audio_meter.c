@@ -0,0 +1,172 @@
+#include "audio_meter.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#define METER_RING_SIZE CONFIG_RESPEAKER_AUDIO_METER_RING_SIZE
+#define METER_RING_MASK (METER_RING_SIZE - 1U)
+
+BUILD_ASSERT((METER_RING_SIZE & METER_RING_MASK) == 0U,
+	     "RESPEAKER_AUDIO_METER_RING_SIZE must be a power of two");
+
+/*
+ * head and tail are free-running counters: head is only written by the
+ * producer, tail only by the consumer. The slot is filled before head
+ * moves past it and read before tail does, and the atomic stores order
+ * those accesses, so no lock is needed between the two sides.
+ */
+static struct audio_meter_sample meter_ring[METER_RING_SIZE];
+static atomic_t meter_head;
+static atomic_t meter_tail;
+static atomic_t meter_dropped;
+
+bool audio_meter_push(uint16_t peak, uint16_t rms)
+{
+	uint32_t head = (uint32_t)atomic_get(&meter_head);
+	uint32_t tail = (uint32_t)atomic_get(&meter_tail);
+
+	if ((head - tail) >= METER_RING_SIZE) {
+		(void)atomic_inc(&meter_dropped);
+		return false;
+	}
+
+	meter_ring[head & METER_RING_MASK] = (struct audio_meter_sample){
+		.peak = peak,
+		.rms = rms,
+	};
+	(void)atomic_set(&meter_head, (atomic_val_t)(head + 1U));
+	return true;
+}
+
+static uint16_t isqrt32(uint32_t v)
+{
+	uint32_t root = 0U;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > v) {
+		bit >>= 2;
+	}
+	while (bit != 0U) {
+		if (v >= root + bit) {
+			v -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (uint16_t)root;
+}
+
+bool audio_meter_push_pcm(const int16_t *pcm, size_t count)
+{
+	uint32_t peak = 0U;
+	uint64_t sum_sq = 0U;
+
+	if (count == 0U) {
+		return false;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		int32_t s = pcm[i];
+		uint32_t mag = (uint32_t)((s < 0) ? -s : s);
+
+		peak = MAX(peak, mag);
+		sum_sq += (uint64_t)((int64_t)s * s);
+	}
+
+	return audio_meter_push((uint16_t)peak, isqrt32((uint32_t)(sum_sq / count)));
+}
+
+bool audio_meter_drain(struct audio_meter_sample *out)
+{
+	uint32_t tail = (uint32_t)atomic_get(&meter_tail);
+	uint32_t head = (uint32_t)atomic_get(&meter_head);
+	struct audio_meter_sample acc = { 0 };
+
+	if (head == tail) {
+		return false;
+	}
+
+	for (; tail != head; tail++) {
+		const struct audio_meter_sample *s = &meter_ring[tail & METER_RING_MASK];
+
+		acc.peak = MAX(acc.peak, s->peak);
+		acc.rms = MAX(acc.rms, s->rms);
+	}
+	(void)atomic_set(&meter_tail, (atomic_val_t)tail);
+
+	*out = acc;
+	return true;
+}
+
+uint32_t audio_meter_dropped(void)
+{
+	return (uint32_t)atomic_get(&meter_dropped);
+}
+
+uint8_t audio_meter_level(uint16_t peak)
+{
+	uint32_t msb;
+	uint32_t frac;
+	uint32_t steps;
+
+	if (peak == 0U) {
+		return 0U;
+	}
+
+	/* 6 dB per bit, split into 8 steps by the three bits below the MSB. */
+	msb = 31U - (uint32_t)__builtin_clz(peak);
+	frac = (msb >= 3U) ? ((uint32_t)peak >> (msb - 3U)) & 7U : ((uint32_t)peak << (3U - msb)) & 7U;
+	steps = msb * 8U + frac;
+
+	return (uint8_t)MIN((steps * 100U) / (15U * 8U), 100U);
+}
+
+#ifdef CONFIG_RESPEAKER_AUDIO_METER_SIM
+/*
+ * Stand-in producer until the capture path feeds the meter: one random
+ * block level every CONFIG_RESPEAKER_AUDIO_METER_SIM_BLOCK_MS, spread
+ * evenly over the log scale like the previous per-tick random volume.
+ */
+static uint32_t meter_sim_prng(void)
+{
+	static uint32_t s = 0x12345678U;
+
+	s ^= s << 13;
+	s ^= s >> 17;
+	s ^= s << 5;
+	return s;
+}
+
+static void meter_sim_timer_cb(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+	uint32_t r = meter_sim_prng();
+	uint32_t bits = 1U + (r % 14U);
+	uint16_t peak = (uint16_t)((1UL << bits) | ((r >> 8) & ((1UL << bits) - 1U)));
+
+	(void)audio_meter_push(peak, (uint16_t)(peak / 2U));
+}
+
+K_TIMER_DEFINE(meter_sim_timer, meter_sim_timer_cb, NULL);
+#endif /* CONFIG_RESPEAKER_AUDIO_METER_SIM */
+
+void audio_meter_start(void)
+{
+	struct audio_meter_sample stale;
+
+	(void)audio_meter_drain(&stale);
+#ifdef CONFIG_RESPEAKER_AUDIO_METER_SIM
+	k_timer_start(&meter_sim_timer, K_MSEC(CONFIG_RESPEAKER_AUDIO_METER_SIM_BLOCK_MS),
+		      K_MSEC(CONFIG_RESPEAKER_AUDIO_METER_SIM_BLOCK_MS));
+#endif
+}
+
+void audio_meter_stop(void)
+{
+#ifdef CONFIG_RESPEAKER_AUDIO_METER_SIM
+	k_timer_stop(&meter_sim_timer);
+#endif
+}
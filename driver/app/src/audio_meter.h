@@ -0,0 +1,60 @@
+#ifndef APP_AUDIO_METER_H
+#define APP_AUDIO_METER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Input level meter between the audio capture path and the UI.
+ *
+ * The capture thread (the single producer) pushes one peak/RMS pair per
+ * audio block into a lock-free ring; the UI thread (the single consumer)
+ * drains it on its own tick. Neither side takes a lock or copies more than
+ * one 4-byte sample, and a full ring drops the new block instead of making
+ * the audio path wait. The UI shows at most
+ * CONFIG_RESPEAKER_AUDIO_METER_RING_SIZE blocks plus one UI tick late.
+ */
+struct audio_meter_sample {
+	uint16_t peak; /* max |sample| of the block, 0..32768 */
+	uint16_t rms;  /* RMS of the block, same scale */
+};
+
+/*
+ * Recording scenes call start on entry and stop on exit, from the consumer
+ * (UI) thread. start drops levels left over from the last session; with
+ * CONFIG_RESPEAKER_AUDIO_METER_SIM=y the pair also runs the simulated
+ * producer, so it only wakes the system while a meter is on screen.
+ */
+void audio_meter_start(void);
+
+void audio_meter_stop(void);
+
+/* Producer: queue one block's levels. Returns false if the ring was full. */
+bool audio_meter_push(uint16_t peak, uint16_t rms);
+
+/* Producer: measure a block of 16-bit PCM and queue it. */
+bool audio_meter_push_pcm(const int16_t *pcm, size_t count);
+
+/*
+ * Consumer: take every queued block and return their maximum peak and RMS
+ * in out. Returns false (out untouched) when nothing arrived since the
+ * last call.
+ */
+bool audio_meter_drain(struct audio_meter_sample *out);
+
+/* Blocks dropped because the consumer fell behind. */
+uint32_t audio_meter_dropped(void);
+
+/* Map a peak to a 0..100 UI level: log scale, about 0.9 dB per step. */
+uint8_t audio_meter_level(uint16_t peak);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_AUDIO_METER_H */
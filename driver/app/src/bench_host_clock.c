@@ -0,0 +1,17 @@
+/*
+ * Runner-side (host libc) part of the native_sim LVGL benchmark. Built into
+ * the native_simulator target, not the Zephyr app, see CMakeLists.txt.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+#include "bench_host_clock.h"
+
+uint64_t bench_host_clock_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,21 @@
+#ifndef APP_BENCH_HOST_CLOCK_H
+#define APP_BENCH_HOST_CLOCK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Host CLOCK_MONOTONIC in ns, for timing work on native_sim where the
+ * kernel's cycle counter is simulated time and code takes none of it.
+ * Implemented on the runner side (src/bench_host_clock.c, host libc).
+ */
+uint64_t bench_host_clock_ns(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_BENCH_HOST_CLOCK_H */
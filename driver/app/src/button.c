@@ -5,16 +5,16 @@
 #include <zephyr/devicetree.h>
 
 #include "input/button_gesture.h"
+#include "ui_event.h"
 
 LOG_MODULE_REGISTER(app_button, CONFIG_LOG_DEFAULT_LEVEL);
 
-K_MSGQ_DEFINE(button_evt_q, sizeof(button_event_t), 8, 4);
-
 static const struct device *btn_gesture_dev;
 
 static void button_emit(button_event_t evt)
 {
-	(void)k_msgq_put(&button_evt_q, &evt, K_NO_WAIT);
+	/* A full button queue is counted in the bus stats (UI_EVT_BUTTON). */
+	(void)ui_event_post_button(evt);
 }
 
 static void gesture_cb(const struct device *dev, enum button_gesture_action action, void *user_data)
@@ -57,7 +57,6 @@ int button_init(void)
 		return -ENODEV;
 	}
 
-	k_msgq_purge(&button_evt_q);
 	int ret = 0;
 	ret |= button_gesture_register_callback(btn_gesture_dev, BUTTON_GESTURE_SINGLE, gesture_cb, NULL);
 	ret |= button_gesture_register_callback(btn_gesture_dev, BUTTON_GESTURE_DOUBLE, gesture_cb, NULL);
@@ -70,12 +69,3 @@ int button_init(void)
 	LOG_INF("Button wrapper bound to gesture device");
 	return 0;
 }
-
-int button_get_event(button_event_t *evt, k_timeout_t timeout)
-{
-	if (!evt) {
-		return -EINVAL;
-	}
-
-	return k_msgq_get(&button_evt_q, evt, timeout);
-}
@@ -14,17 +14,10 @@ typedef enum {
 	BUTTON_EVENT_DOUBLE_PRESS,
 } button_event_t;
 
-int button_init(void);
-
-/* Get next button event.
- * Returns 0 on success, -EAGAIN on timeout/no data.
+/* Bind the gesture device; gestures are posted to the UI event bus
+ * (ui_event.h) as UI_EVT_BUTTON events.
  */
-int button_get_event(button_event_t *evt, k_timeout_t timeout);
-
-static inline int button_get_event_no_wait(button_event_t *evt)
-{
-	return button_get_event(evt, K_NO_WAIT);
-}
+int button_init(void);
 
 #ifdef __cplusplus
 }
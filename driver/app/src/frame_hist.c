@@ -0,0 +1,71 @@
+#include "frame_hist.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+
+static uint32_t bucket_upper_us(uint32_t i)
+{
+	return FRAME_HIST_BASE_US << i;
+}
+
+void frame_hist_reset(struct frame_hist *h)
+{
+	memset(h, 0, sizeof(*h));
+	h->min_us = UINT32_MAX;
+}
+
+void frame_hist_add(struct frame_hist *h, uint32_t us)
+{
+	uint32_t i = 0U;
+
+	while (i < (FRAME_HIST_BUCKETS - 1U) && us >= bucket_upper_us(i)) {
+		i++;
+	}
+	h->bucket[i]++;
+	h->count++;
+	h->sum_us += us;
+	h->min_us = MIN(h->min_us, us);
+	h->max_us = MAX(h->max_us, us);
+}
+
+uint32_t frame_hist_percentile(const struct frame_hist *h, uint32_t pct)
+{
+	uint32_t target = (uint32_t)(((uint64_t)h->count * MIN(pct, 100U) + 99U) / 100U);
+	uint32_t seen = 0U;
+
+	for (uint32_t i = 0U; i < FRAME_HIST_BUCKETS; i++) {
+		seen += h->bucket[i];
+		if (seen >= target && seen > 0U) {
+			/* The open-ended bucket reports the largest sample instead. */
+			return (i == FRAME_HIST_BUCKETS - 1U) ? h->max_us : bucket_upper_us(i);
+		}
+	}
+	return 0U;
+}
+
+void frame_hist_print(const struct frame_hist *h, const char *name)
+{
+	if (h->count == 0U) {
+		printk("%s: no samples\n", name);
+		return;
+	}
+
+	printk("%s: n=%u min=%u avg=%u max=%u us, p50<%u p90<%u p99<%u us\n", name, h->count,
+	       h->min_us, (uint32_t)(h->sum_us / h->count), h->max_us,
+	       frame_hist_percentile(h, 50U), frame_hist_percentile(h, 90U),
+	       frame_hist_percentile(h, 99U));
+
+	printk("%s:", name);
+	for (uint32_t i = 0U; i < FRAME_HIST_BUCKETS; i++) {
+		if (h->bucket[i] == 0U) {
+			continue;
+		}
+		if (i == FRAME_HIST_BUCKETS - 1U) {
+			printk(" >=%u:%u", bucket_upper_us(i - 1U), h->bucket[i]);
+		} else {
+			printk(" <%u:%u", bucket_upper_us(i), h->bucket[i]);
+		}
+	}
+	printk("\n");
+}
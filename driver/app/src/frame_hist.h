@@ -0,0 +1,42 @@
+#ifndef APP_FRAME_HIST_H
+#define APP_FRAME_HIST_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Log2 time histogram for frame timing (microseconds). Bucket 0 counts
+ * samples below FRAME_HIST_BASE_US; bucket i counts [BASE << (i - 1),
+ * BASE << i); the last bucket is open-ended (>= ~65 ms with the defaults).
+ * Adding a sample is a handful of integer ops, so it is safe to call from
+ * LVGL event callbacks.
+ */
+#define FRAME_HIST_BASE_US 64U
+#define FRAME_HIST_BUCKETS 12
+
+struct frame_hist {
+	uint32_t count;
+	uint32_t min_us;
+	uint32_t max_us;
+	uint64_t sum_us;
+	uint32_t bucket[FRAME_HIST_BUCKETS];
+};
+
+void frame_hist_reset(struct frame_hist *h);
+
+void frame_hist_add(struct frame_hist *h, uint32_t us);
+
+/* Upper bound (us) of the bucket holding the pct-th percentile (0..100). */
+uint32_t frame_hist_percentile(const struct frame_hist *h, uint32_t pct);
+
+/* One summary line plus one line of non-empty buckets, via printk. */
+void frame_hist_print(const struct frame_hist *h, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_FRAME_HIST_H */
@@ -0,0 +1,210 @@
+#pragma once
+
+/* Generated by tools/gen_info_icon_atlas.py - do not edit. */
+
+#include <stdint.h>
+
+#include <lvgl.h>
+
+/*
+ * INFO page icon atlas (1bpp), one tile per icon state.
+ * - Layout: LV_COLOR_FORMAT_I1, 8-byte palette + row-major MSB-first rows
+ * - Value:  1 = lit pixel
+ */
+
+#define INFO_ATLAS_TILE_W 20
+#define INFO_ATLAS_TILE_H 20
+#define INFO_ATLAS_TILE_BYTES 68
+#define INFO_ATLAS_BAT_LEVELS 6
+
+enum info_icon {
+	INFO_ICON_BAT_L0,
+	INFO_ICON_BAT_L1,
+	INFO_ICON_BAT_L2,
+	INFO_ICON_BAT_L3,
+	INFO_ICON_BAT_L4,
+	INFO_ICON_BAT_L5,
+	INFO_ICON_BAT_CHG_L0,
+	INFO_ICON_BAT_CHG_L1,
+	INFO_ICON_BAT_CHG_L2,
+	INFO_ICON_BAT_CHG_L3,
+	INFO_ICON_BAT_CHG_L4,
+	INFO_ICON_BAT_CHG_L5,
+	INFO_ICON_WIRE_DISCONNECTED,
+	INFO_ICON_WIRE_CONNECTED,
+	INFO_ICON_WIRE_BT_TX,
+	INFO_ICON_WIRE_WIFI_TX,
+	INFO_ICON_MODE_NORMAL,
+	INFO_ICON_MODE_ENH,
+	INFO_ICON_PENDING,
+	INFO_ICON_COUNT,
+};
+
+static const uint8_t info_icon_atlas[INFO_ICON_COUNT * INFO_ATLAS_TILE_BYTES] = {
+	/* BAT_L0 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_L1 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1E, 0x01, 0x80, 0x1E,
+	0x01, 0x80, 0x1E, 0x01, 0x80, 0x1E, 0x01, 0x80, 0x1E, 0x01, 0x80, 0x1E,
+	0x01, 0x80, 0x1E, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_L2 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x81, 0x80, 0x1F,
+	0x81, 0x80, 0x1F, 0x81, 0x80, 0x1F, 0x81, 0x80, 0x1F, 0x81, 0x80, 0x1F,
+	0x81, 0x80, 0x1F, 0x81, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_L3 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xE1, 0x80, 0x1F,
+	0xE1, 0x80, 0x1F, 0xE1, 0x80, 0x1F, 0xE1, 0x80, 0x1F, 0xE1, 0x80, 0x1F,
+	0xE1, 0x80, 0x1F, 0xE1, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_L4 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xF9, 0x80, 0x1F,
+	0xF9, 0x80, 0x1F, 0xF9, 0x80, 0x1F, 0xF9, 0x80, 0x1F, 0xF9, 0x80, 0x1F,
+	0xF9, 0x80, 0x1F, 0xF9, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_L5 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_CHG_L0 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_CHG_L1 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1E, 0x01, 0x80, 0x1E,
+	0x01, 0x80, 0x1E, 0x01, 0x80, 0x1E, 0x01, 0x80, 0x1E, 0x01, 0x80, 0x1E,
+	0x01, 0x80, 0x1E, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_CHG_L2 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x81, 0x80, 0x1F,
+	0x81, 0x80, 0x1F, 0x81, 0x80, 0x1F, 0x01, 0x80, 0x1F, 0x01, 0x80, 0x1F,
+	0x01, 0x80, 0x1F, 0x81, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_CHG_L3 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x81, 0x80, 0x1F,
+	0x81, 0x80, 0x1F, 0x81, 0x80, 0x1F, 0x01, 0x80, 0x1F, 0x01, 0x80, 0x1F,
+	0x01, 0x80, 0x1F, 0xE1, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_CHG_L4 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x89, 0x80, 0x1F,
+	0x89, 0x80, 0x1F, 0x89, 0x80, 0x1F, 0x01, 0x80, 0x1F, 0x01, 0x80, 0x1F,
+	0x01, 0x80, 0x1F, 0xF9, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* BAT_CHG_L5 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x8F, 0x80, 0x1F,
+	0x8F, 0x80, 0x1F, 0x8F, 0x80, 0x1F, 0x07, 0x80, 0x1F, 0x07, 0x80, 0x1F,
+	0x07, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* WIRE_DISCONNECTED */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0xCF, 0x80, 0x1F,
+	0x7F, 0x80, 0x1F, 0x7F, 0x80, 0x1F, 0x7F, 0x80, 0x1F, 0x1F, 0x80, 0x00,
+	0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* WIRE_CONNECTED */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0x80, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x0F, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* WIRE_BT_TX */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,
+	0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x1F, 0x0F, 0xE0, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x0F, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* WIRE_WIFI_TX */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF0, 0x00,
+	0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x1F, 0x0F, 0xF0, 0x1F,
+	0xFF, 0xB0, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0x0F, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* MODE_NORMAL */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01,
+	0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
+	0xF8, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
+	/* MODE_ENH */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01,
+	0xF8, 0x00, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x19,
+	0xF9, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x19,
+	0xF9, 0x80, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
+	/* PENDING */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03,
+	0xFE, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80,
+};
+
+#define INFO_ICON_IMG(i) \
+	{ \
+		.header.magic = LV_IMAGE_HEADER_MAGIC, \
+		.header.cf = LV_COLOR_FORMAT_I1, \
+		.header.w = INFO_ATLAS_TILE_W, \
+		.header.h = INFO_ATLAS_TILE_H, \
+		.header.stride = (INFO_ATLAS_TILE_W + 7) / 8, \
+		.data_size = INFO_ATLAS_TILE_BYTES, \
+		.data = &info_icon_atlas[(i) * INFO_ATLAS_TILE_BYTES], \
+	}
+
+static const lv_image_dsc_t info_icon_img[INFO_ICON_COUNT] = {
+	INFO_ICON_IMG(INFO_ICON_BAT_L0),
+	INFO_ICON_IMG(INFO_ICON_BAT_L1),
+	INFO_ICON_IMG(INFO_ICON_BAT_L2),
+	INFO_ICON_IMG(INFO_ICON_BAT_L3),
+	INFO_ICON_IMG(INFO_ICON_BAT_L4),
+	INFO_ICON_IMG(INFO_ICON_BAT_L5),
+	INFO_ICON_IMG(INFO_ICON_BAT_CHG_L0),
+	INFO_ICON_IMG(INFO_ICON_BAT_CHG_L1),
+	INFO_ICON_IMG(INFO_ICON_BAT_CHG_L2),
+	INFO_ICON_IMG(INFO_ICON_BAT_CHG_L3),
+	INFO_ICON_IMG(INFO_ICON_BAT_CHG_L4),
+	INFO_ICON_IMG(INFO_ICON_BAT_CHG_L5),
+	INFO_ICON_IMG(INFO_ICON_WIRE_DISCONNECTED),
+	INFO_ICON_IMG(INFO_ICON_WIRE_CONNECTED),
+	INFO_ICON_IMG(INFO_ICON_WIRE_BT_TX),
+	INFO_ICON_IMG(INFO_ICON_WIRE_WIFI_TX),
+	INFO_ICON_IMG(INFO_ICON_MODE_NORMAL),
+	INFO_ICON_IMG(INFO_ICON_MODE_ENH),
+	INFO_ICON_IMG(INFO_ICON_PENDING),
+};
@@ -0,0 +1,431 @@
+/*
+ * LVGL render benchmark for the 88x48 CH1115 (grown out of the old FPS
+ * stress test in main.c).
+ *
+ * Runs a fixed list of scripted scenarios, each for
+ * CONFIG_RESPEAKER_BENCH_SCENARIO_MS, and prints one CSV row per scenario
+ * over the console. Every scenario is driven by LVGL timers with fixed
+ * periods and a fixed PRNG seed, so two runs on the same build produce the
+ * same frame sequence; on native_sim with the CH1115 emulator the numbers
+ * are reproducible enough for CI trend tracking.
+ *
+ * CSV columns:
+ *   scenario, ms, refr, render, flush_wait   - LVGL display event counts
+ *   refr_fps_x10                             - refreshes per second x10
+ *   render_us_avg/p50/p90/max                - RENDER_START..RENDER_READY
+ *   render_cyc_avg                           - same, in cycles
+ *   bus_bytes                                - GDDRAM bytes sent by the driver
+ *
+ * On native_sim the cycle counter is simulated time, in which rendering
+ * takes none, so render times come from the host clock there and
+ * render_cyc_avg is in host ns.
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <lvgl.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef CONFIG_ARCH_POSIX
+#include <posix_board_if.h>
+#include "bench_host_clock.h"
+#endif
+
+#include "display/ch1115.h"
+#include "frame_hist.h"
+#include "rec_wave.h"
+#include "vtiled_flush.h"
+
+LOG_MODULE_REGISTER(lvgl_bench, LOG_LEVEL_INF);
+
+#define OLED_W 88
+#define OLED_H 48
+
+#define BENCH_FG lv_color_make(0xFF, 0xFF, 0xFF)
+#define BENCH_BG lv_color_make(0x00, 0x00, 0x00)
+
+/* Scenario step periods (ms). */
+#define BOX_PERIOD_MS 5
+#define BARS_PERIOD_MS 20
+#define SWITCH_PERIOD_MS 100
+#define LABEL_PERIOD_MS 20
+
+#define BOX_W 10
+#define BOX_H 10
+
+struct bench_counters {
+	uint32_t refr;
+	uint32_t render;
+	uint32_t flush_wait;
+	uint32_t render_t0;
+	uint64_t render_cyc;
+	struct frame_hist render_us;
+};
+
+static struct bench_counters cnt;
+
+#ifdef CONFIG_ARCH_POSIX
+static inline uint32_t bench_clock(void)
+{
+	return (uint32_t)bench_host_clock_ns();
+}
+
+static inline uint32_t bench_clock_to_us(uint32_t t)
+{
+	return t / 1000U;
+}
+#else
+static inline uint32_t bench_clock(void)
+{
+	return k_cycle_get_32();
+}
+
+static inline uint32_t bench_clock_to_us(uint32_t t)
+{
+	return k_cyc_to_us_floor32(t);
+}
+#endif
+
+static void bench_display_event_cb(lv_event_t *e)
+{
+	switch (lv_event_get_code(e)) {
+	case LV_EVENT_REFR_READY:
+		cnt.refr++;
+		break;
+	case LV_EVENT_RENDER_START:
+		cnt.render_t0 = bench_clock();
+		break;
+	case LV_EVENT_RENDER_READY: {
+		uint32_t cyc = bench_clock() - cnt.render_t0;
+
+		cnt.render++;
+		cnt.render_cyc += cyc;
+		frame_hist_add(&cnt.render_us, bench_clock_to_us(cyc));
+		break;
+	}
+	case LV_EVENT_FLUSH_WAIT_FINISH:
+		cnt.flush_wait++;
+		break;
+	default:
+		break;
+	}
+}
+
+/* Tiny deterministic PRNG, reseeded per scenario. */
+static uint32_t prng_state;
+
+static uint32_t prng_u32(void)
+{
+	prng_state ^= prng_state << 13;
+	prng_state ^= prng_state >> 17;
+	prng_state ^= prng_state << 5;
+	return prng_state;
+}
+
+static lv_obj_t *bench_rect(lv_obj_t *parent, int x, int y, int w, int h)
+{
+	lv_obj_t *r = lv_obj_create(parent);
+	if (!r) {
+		return NULL;
+	}
+	lv_obj_set_size(r, w, h);
+	lv_obj_set_pos(r, x, y);
+	lv_obj_set_style_radius(r, 0, 0);
+	lv_obj_set_style_border_width(r, 0, 0);
+	lv_obj_set_style_pad_all(r, 0, 0);
+	lv_obj_set_style_bg_opa(r, LV_OPA_COVER, 0);
+	lv_obj_set_style_bg_color(r, BENCH_FG, 0);
+	lv_obj_clear_flag(r, LV_OBJ_FLAG_SCROLLABLE);
+	return r;
+}
+
+static lv_obj_t *bench_page(lv_obj_t *parent)
+{
+	lv_obj_t *p = lv_obj_create(parent);
+	if (!p) {
+		return NULL;
+	}
+	lv_obj_set_size(p, OLED_W, OLED_H);
+	lv_obj_set_pos(p, 0, 0);
+	lv_obj_set_style_radius(p, 0, 0);
+	lv_obj_set_style_border_width(p, 0, 0);
+	lv_obj_set_style_pad_all(p, 0, 0);
+	lv_obj_set_style_bg_opa(p, LV_OPA_COVER, 0);
+	lv_obj_set_style_bg_color(p, BENCH_BG, 0);
+	lv_obj_clear_flag(p, LV_OBJ_FLAG_SCROLLABLE);
+	return p;
+}
+
+static lv_obj_t *bench_label(lv_obj_t *parent, const char *text, int y)
+{
+	lv_obj_t *l = lv_label_create(parent);
+	if (!l) {
+		return NULL;
+	}
+	lv_label_set_text(l, text);
+	lv_obj_set_width(l, OLED_W);
+	lv_label_set_long_mode(l, LV_LABEL_LONG_CLIP);
+	lv_obj_set_style_text_font(l, &lv_font_montserrat_14, 0);
+	lv_obj_set_style_text_align(l, LV_TEXT_ALIGN_CENTER, 0);
+	lv_obj_set_style_text_color(l, BENCH_FG, 0);
+	lv_obj_align(l, LV_ALIGN_TOP_MID, 0, y);
+	return l;
+}
+
+/* ---- Scenarios: setup() builds under root and starts st.timer ---- */
+
+struct bench_state {
+	lv_timer_t *timer;
+	lv_obj_t *obj[4];
+	int16_t box_x;
+	int8_t box_dx;
+	uint32_t step;
+	struct rec_wave wave;
+};
+
+static struct bench_state st;
+
+/* Moving box: the old FPS stress test (2 px every 5 ms, bouncing). */
+static void box_step(lv_timer_t *t)
+{
+	LV_UNUSED(t);
+	const int16_t max_x = OLED_W - BOX_W;
+
+	st.box_x = (int16_t)(st.box_x + st.box_dx);
+	if (st.box_x <= 0) {
+		st.box_x = 0;
+		st.box_dx = 2;
+	} else if (st.box_x >= max_x) {
+		st.box_x = max_x;
+		st.box_dx = -2;
+	}
+	lv_obj_set_x(st.obj[0], st.box_x);
+}
+
+static int box_setup(lv_obj_t *root)
+{
+	st.box_x = 0;
+	st.box_dx = 2;
+	st.obj[0] = bench_rect(root, 0, 18, BOX_W, BOX_H);
+	if (!st.obj[0]) {
+		return -ENOMEM;
+	}
+	st.timer = lv_timer_create(box_step, BOX_PERIOD_MS, NULL);
+	if (!st.timer) {
+		return -ENOMEM;
+	}
+	return 0;
+}
+
+/* Recording bars: the rec_wave widget scrolling with random volume. */
+static void bars_step(lv_timer_t *t)
+{
+	LV_UNUSED(t);
+
+	if (rec_wave_scroll(&st.wave)) {
+		rec_wave_push(&st.wave, (uint8_t)(REC_MIN_HALF_H +
+						  prng_u32() % (REC_MAX_HALF_H - REC_MIN_HALF_H + 1)));
+	}
+	rec_wave_set_volume(&st.wave, (uint8_t)(prng_u32() % (REC_VOL_MAX + 1)));
+}
+
+static int bars_setup(lv_obj_t *root)
+{
+	if (!rec_wave_create(&st.wave, root, BENCH_FG)) {
+		return -ENOMEM;
+	}
+	for (int i = 0; i < REC_BAR_COUNT; i++) {
+		st.wave.half_h[i] = (uint8_t)(REC_MIN_HALF_H + prng_u32() % REC_MAX_HALF_H);
+	}
+	rec_wave_reset(&st.wave);
+	st.timer = lv_timer_create(bars_step, BARS_PERIOD_MS, NULL);
+	if (!st.timer) {
+		return -ENOMEM;
+	}
+	return 0;
+}
+
+/* Scene switch: two full-screen pages (label + blocks) swapped in turn. */
+static void switch_step(lv_timer_t *t)
+{
+	LV_UNUSED(t);
+	bool a = (st.step++ & 1U) == 0U;
+
+	if (a) {
+		lv_obj_add_flag(st.obj[1], LV_OBJ_FLAG_HIDDEN);
+		lv_obj_clear_flag(st.obj[0], LV_OBJ_FLAG_HIDDEN);
+	} else {
+		lv_obj_add_flag(st.obj[0], LV_OBJ_FLAG_HIDDEN);
+		lv_obj_clear_flag(st.obj[1], LV_OBJ_FLAG_HIDDEN);
+	}
+}
+
+static int switch_setup(lv_obj_t *root)
+{
+	st.step = 0U;
+	st.obj[0] = bench_page(root);
+	st.obj[1] = bench_page(root);
+	if (!st.obj[0] || !st.obj[1] || !bench_label(st.obj[0], "INFO", 4) ||
+	    !bench_label(st.obj[1], "MUTE", 4)) {
+		return -ENOMEM;
+	}
+	for (int i = 0; i < 4; i++) {
+		if (!bench_rect(st.obj[0], 1 + i * 22, 24, 20, 20) ||
+		    !bench_rect(st.obj[1], 10, 26 + (i & 1) * 10, 68, 4)) {
+			return -ENOMEM;
+		}
+	}
+	lv_obj_add_flag(st.obj[1], LV_OBJ_FLAG_HIDDEN);
+	st.timer = lv_timer_create(switch_step, SWITCH_PERIOD_MS, NULL);
+	if (!st.timer) {
+		return -ENOMEM;
+	}
+	return 0;
+}
+
+/* Label updates: a changing counter, re-shaped every step. */
+static void label_step(lv_timer_t *t)
+{
+	LV_UNUSED(t);
+	char buf[16];
+
+	snprintf(buf, sizeof(buf), "%05u", (unsigned)(st.step++ * 7U));
+	lv_label_set_text(st.obj[0], buf);
+}
+
+static int label_setup(lv_obj_t *root)
+{
+	st.step = 0U;
+	st.obj[0] = bench_label(root, "00000", 16);
+	if (!st.obj[0]) {
+		return -ENOMEM;
+	}
+	st.timer = lv_timer_create(label_step, LABEL_PERIOD_MS, NULL);
+	if (!st.timer) {
+		return -ENOMEM;
+	}
+	return 0;
+}
+
+static void bench_stop(void)
+{
+	if (st.timer) {
+		lv_timer_delete(st.timer);
+		st.timer = NULL;
+	}
+}
+
+struct bench_scenario {
+	const char *name;
+	int (*setup)(lv_obj_t *root);
+};
+
+static const struct bench_scenario scenarios[] = {
+	{ "box", box_setup },
+	{ "rec_bars", bars_setup },
+	{ "scene_switch", switch_setup },
+	{ "label", label_setup },
+};
+
+static int bench_run(const struct device *display_dev, const struct bench_scenario *sc)
+{
+	struct ch1115_stats bus;
+	lv_obj_t *root;
+	uint32_t start;
+	int ret;
+
+	root = bench_page(lv_screen_active());
+	if (!root) {
+		return -ENOMEM;
+	}
+
+	memset(&st, 0, sizeof(st));
+	prng_state = 0x12345678U;
+	ret = sc->setup(root);
+	if (ret != 0) {
+		bench_stop();
+		lv_obj_delete(root);
+		return ret;
+	}
+
+	/* Settle the first full frame, then measure from a clean state. */
+	lv_refr_now(NULL);
+	(void)ch1115_flush(display_dev);
+	memset(&cnt, 0, sizeof(cnt));
+	frame_hist_reset(&cnt.render_us);
+	ch1115_reset_stats(display_dev);
+
+	start = k_uptime_get_32();
+	while ((k_uptime_get_32() - start) < CONFIG_RESPEAKER_BENCH_SCENARIO_MS) {
+		uint32_t idle_ms = lv_timer_handler();
+
+		k_msleep(MIN(idle_ms, 5U));
+	}
+	(void)ch1115_flush(display_dev);
+
+	uint32_t ms = k_uptime_get_32() - start;
+
+	ch1115_get_stats(display_dev, &bus);
+	printk("%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n", sc->name, ms, cnt.refr, cnt.render,
+	       cnt.flush_wait, (cnt.refr * 10000U) / MAX(ms, 1U),
+	       cnt.render_us.count ? (uint32_t)(cnt.render_us.sum_us / cnt.render_us.count) : 0U,
+	       frame_hist_percentile(&cnt.render_us, 50U),
+	       frame_hist_percentile(&cnt.render_us, 90U), cnt.render_us.max_us,
+	       cnt.render ? (uint32_t)(cnt.render_cyc / cnt.render) : 0U, bus.bytes_sent);
+
+	bench_stop();
+	lv_obj_delete(root);
+	return 0;
+}
+
+int main(void)
+{
+	const struct device *display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+	lv_display_t *disp = lv_display_get_default();
+
+	if (!device_is_ready(display_dev) || !disp) {
+		LOG_ERR("Display device not ready");
+		return 0;
+	}
+
+	(void)display_set_pixel_format(display_dev, PIXEL_FORMAT_MONO10);
+	(void)display_blanking_off(display_dev);
+
+#ifdef CONFIG_RESPEAKER_UI_VTILED_FLUSH
+	static uint8_t vt_buf[OLED_W * OLED_H / 8];
+	static struct vtiled_flush vt;
+	const bool fast_flush =
+		vtiled_flush_install(disp, &vt, display_dev, vt_buf, sizeof(vt_buf)) == 0;
+#else
+	const bool fast_flush = false;
+#endif
+
+	lv_obj_t *scr = lv_screen_active();
+	lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+	lv_obj_set_style_bg_color(scr, BENCH_BG, 0);
+	lv_display_add_event_cb(disp, bench_display_event_cb, LV_EVENT_ALL, NULL);
+
+	printk("bench,lvgl,%ux%u,scenario_ms=%u,refr_period_ms=%u,convert=%s\n", OLED_W, OLED_H,
+	       CONFIG_RESPEAKER_BENCH_SCENARIO_MS, CONFIG_LV_DEF_REFR_PERIOD,
+	       fast_flush ? "8x8" : "stock");
+	printk("scenario,ms,refr,render,flush_wait,refr_fps_x10,render_us_avg,"
+	       "render_us_p50,render_us_p90,render_us_max,render_cyc_avg,bus_bytes\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(scenarios); i++) {
+		int ret = bench_run(display_dev, &scenarios[i]);
+
+		if (ret != 0) {
+			printk("%s,error,%d\n", scenarios[i].name, ret);
+		}
+	}
+	printk("bench,done\n");
+
+#ifdef CONFIG_ARCH_POSIX
+	/* native_sim: end the process so CI gets the console and an exit code. */
+	posix_exit(0);
+#endif
+	return 0;
+}
@@ -3,42 +3,40 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/pm/device.h>
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_SETTINGS
+#include <zephyr/settings/settings.h>
+#endif
 #include <lvgl.h>
 #include <errno.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "audio_meter.h"
 #include "button.h"
+#include "display/ch1115.h"
+#include "frame_hist.h"
+#include "info_icon_atlas.h"
+#include "rec_wave.h"
+#include "ui_event.h"
+#include "ui_prof.h"
+#include "vtiled_flush.h"
 
-/* Keep FPS stress test quiet (results are shown on-screen). */
 LOG_MODULE_REGISTER(l7_e1_lvgl, LOG_LEVEL_ERR);
 
 /*
  * NOTE:
- * This file originally implemented an FPS stress test.
- * Per request: keep the FPS test functions, but do not call them from main.
+ * This file originally implemented an FPS stress test. It now lives in the
+ * LVGL benchmark variant (src/lvgl_bench.c, CONFIG_RESPEAKER_APP_VARIANT_LVGL_BENCH).
  */
 
 #define OLED_W 88
 #define OLED_H 48
 
-/* Recording bars: fill the full 88px width. */
-/* New effect: thin columns (2px) with constant spacing, pixel-scroll left.
- * Right side spawns as dots; after crossing the centerline, dots expand
- * into symmetric bars with per-column random height + brightness.
+/* Recording bars: fill the full 88px width (geometry lives in rec_wave.h).
+ * Thin columns with constant spacing, pixel-scroll left. Right side spawns
+ * as dots; after crossing the centerline, dots expand into symmetric bars
+ * with per-column random height.
  */
-#define REC_BAR_W 1
-#define REC_BAR_W_MAX 3
-#define REC_BAR_GAP 4
-#define REC_BAR_PITCH (REC_BAR_W + REC_BAR_GAP)
-#define REC_BAR_COUNT (((OLED_W + REC_BAR_PITCH - 1) / REC_BAR_PITCH) + 4)
-#define REC_DOT_H 2
-#define REC_MAX_HALF_H 18
-#define REC_MIN_HALF_H 2
-#define REC_GROW_RANGE_PX 14
-
-/* Simulated recording volume range (0..100). */
-#define REC_VOL_MIN 0
-#define REC_VOL_MAX 100
 
 /* INFO icons: 4 tiles in one centered row. */
 #define INFO_ICON_SIZE 20
@@ -48,154 +46,18 @@ LOG_MODULE_REGISTER(l7_e1_lvgl, LOG_LEVEL_ERR);
 
 /* 1bpp OLEDs often make 1px strokes look broken. */
 #define UI_STROKE 2
-/* Per-icon stroke used inside INFO tiles. */
-#define INFO_STROKE 2
-#if defined(CONFIG_L7_E1_LVGL_FPS_TEST)
-#define BOX_W  10
-#define BOX_H  10
-#define ANIM_PERIOD_MS  5
-#define STATS_PERIOD_MS 1000
-
-static lv_obj_t *fps_label;
-static lv_obj_t *hint_label;
-static lv_obj_t *box;
-
-static uint32_t count;
-static int16_t box_x;
-static int8_t box_dx = 2;
-
-static uint32_t refr_cnt;
-static uint32_t render_cnt;
-static uint32_t flush_wait_cnt;
-static uint32_t window_start_ms;
-
-static uint32_t fps_refr;
-static uint32_t fps_render;
-static uint32_t fps_flush_wait;
-static void fps_update_ui(void)
-{
-	char buf[20];
-
-	/* FPS (frame/s): count LVGL refresh cycles completed. */
-	snprintf(buf, sizeof(buf), "%u", (unsigned)fps_refr);
-	lv_label_set_text(fps_label, buf);
-}
-
-static void stats_timer_cb(lv_timer_t *t)
-{
-	LV_UNUSED(t);
-
-	uint32_t now = k_uptime_get_32();
-	uint32_t elapsed = now - window_start_ms;
-	if (window_start_ms == 0U || elapsed == 0U) {
-		window_start_ms = now;
-		refr_cnt = 0U;
-		render_cnt = 0U;
-		flush_wait_cnt = 0U;
-		return;
-	}
-
-	/* Use a 1s-ish window; tolerate drift. */
-	if (elapsed >= 900U) {
-		fps_refr = (refr_cnt * 1000U) / elapsed;
-		fps_render = (render_cnt * 1000U) / elapsed;
-		fps_flush_wait = (flush_wait_cnt * 1000U) / elapsed;
-
-		refr_cnt = 0U;
-		render_cnt = 0U;
-		flush_wait_cnt = 0U;
-		window_start_ms = now;
-	}
-
-	/* Update once per second to avoid the FPS label becoming the bottleneck. */
-	fps_update_ui();
-
-	if (hint_label) {
-		char hint_buf[32];
-		/* On-screen breakdown: render fps + flush-complete fps (helps explain gaps). */
-		snprintf(hint_buf, sizeof(hint_buf), "rn%u fl%u",
-			(unsigned)fps_render,
-			(unsigned)fps_flush_wait);
-		lv_label_set_text(hint_label, hint_buf);
-	}
-}
-
-static void display_event_cb(lv_event_t *e)
-{
-	lv_event_code_t code = lv_event_get_code(e);
-
-	/* NOTE:
-	 * - LV_EVENT_REFR_READY: closest to a "frame" in LVGL terms
-	 * - LV_EVENT_RENDER_READY: render finished (before flush)
-	 * - LV_EVENT_FLUSH_WAIT_FINISH: flush finished including wait callback
-	 */
-	switch (code) {
-	case LV_EVENT_REFR_READY:
-		refr_cnt++;
-		break;
-	case LV_EVENT_RENDER_READY:
-		render_cnt++;
-		break;
-	case LV_EVENT_FLUSH_WAIT_FINISH:
-		flush_wait_cnt++;
-		break;
-	default:
-		break;
-	}
-}
-
-static void anim_timer_cb(lv_timer_t *t)
-{
-	LV_UNUSED(t);
-
-	box_x = (int16_t)(box_x + box_dx);
-	int16_t max_x = (int16_t)(OLED_W - BOX_W);
-
-	if (box_x <= 0) {
-		box_x = 0;
-		box_dx = 2;
-	} else if (box_x >= max_x) {
-		box_x = max_x;
-		box_dx = -2;
-	}
-
-	lv_obj_set_x(box, box_x);
-}
-
-static void create_ui(void)
-{
-	/* Top: FPS value (large, centered). */
-	lv_obj_t *fps_prefix = lv_label_create(lv_screen_active());
-	lv_label_set_text(fps_prefix, "FPS");
-	lv_obj_align(fps_prefix, LV_ALIGN_TOP_LEFT, 0, 0);
-
-	fps_label = lv_label_create(lv_screen_active());
-	lv_label_set_text(fps_label, "0");
-	lv_obj_set_style_text_font(fps_label, &lv_font_montserrat_14, 0);
-	lv_obj_align(fps_label, LV_ALIGN_TOP_MID, 0, 0);
-
-	/* Middle: short mode hint. */
-	hint_label = lv_label_create(lv_screen_active());
-	lv_label_set_text(hint_label, "r0 f0");
-	lv_obj_align(hint_label, LV_ALIGN_CENTER, 0, 0);
-
-	/* A moving solid box to continuously invalidate areas (stress flush). */
-	box = lv_obj_create(lv_screen_active());
-	lv_obj_set_size(box, BOX_W, BOX_H);
-	lv_obj_set_style_radius(box, 0, 0);
-	lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
-	lv_obj_set_style_border_width(box, 0, 0);
-	lv_obj_set_pos(box, 0, 18);
-	box_x = 0;
-
-	/* Timers drive the stress animation and the on-screen stats. */
-	(void)lv_timer_create(anim_timer_cb, ANIM_PERIOD_MS, NULL);
-	(void)lv_timer_create(stats_timer_cb, STATS_PERIOD_MS, NULL);
-}
-#endif /* CONFIG_L7_E1_LVGL_FPS_TEST */
 
 /* ----------------------- Recording pen UI (LVGL demo) ----------------------- */
 
+/* Scene timing (ms). The bars step every UI_BARS_PERIOD_MS; refreshing twice
+ * as often bounds the step-to-panel latency without rendering more frames
+ * than there are steps (idle refresh ticks pause the timer).
+ */
+#define UI_BARS_PERIOD_MS 80
+#define UI_REFR_BARS_MS (UI_BARS_PERIOD_MS / 2)
+#define UI_TIMESTAMP_PERIOD_MS 1000
+#define UI_REFR_ON_DEMAND_MS CONFIG_LV_DEF_REFR_PERIOD
+
 enum ui_scene {
 	UI_SCENE_BLACK = 0,
 	UI_SCENE_INFO,
@@ -203,51 +65,39 @@ enum ui_scene {
 	UI_SCENE_START_RECORDING,
 	UI_SCENE_RECORDING_MUTE,
 	UI_SCENE_TIMESTAMP,
+	UI_SCENE_COUNT,
+};
+
+/* LVGL pages behind the scenes. START_RECORDING, RECORDING_MUTE and
+ * TIMESTAMP share the recording page; BLACK shows no page at all.
+ */
+enum ui_page {
+	UI_PAGE_NONE = 0,
+	UI_PAGE_INFO,
+	UI_PAGE_MUTE,
+	UI_PAGE_REC,
+	UI_PAGE_COUNT,
 };
 
 struct ui_ctx {
-	/* Root containers */
+	/* Root container; pages are built under it on demand */
 	lv_obj_t *root;
-	lv_obj_t *info_cont;
-	lv_obj_t *mute_cont;
-	lv_obj_t *rec_cont;
-
-	/* INFO page (icon-only) */
-	lv_obj_t *bat_outline;
-	lv_obj_t *bat_cap;
-	lv_obj_t *bat_fill;
-	lv_obj_t *bat_charge_a;
-	lv_obj_t *bat_charge_b;
-
-	lv_obj_t *wire_circle;
-	lv_obj_t *wire_state_disconnected;
-	lv_obj_t *wire_state_connected;
-	lv_obj_t *wire_state_bt_tx;
-	lv_obj_t *wire_state_wifi_tx;
-
-	lv_obj_t *mode_icon;
-	lv_obj_t *mode_normal;
-	lv_obj_t *mode_enh;
-
-	lv_obj_t *pending_icon;
-	lv_obj_t *pending_stack_a;
-	lv_obj_t *pending_stack_b;
-	lv_obj_t *pending_arrow;
+	lv_obj_t *page_cont[UI_PAGE_COUNT];
+	enum ui_page page;
+
+	/* INFO page (icon-only): one atlas image per icon */
+	lv_obj_t *bat_img;
+	lv_obj_t *wire_img;
+	lv_obj_t *mode_img;
+	lv_obj_t *pending_img;
 
 	/* Recording widgets */
-	lv_obj_t *bars[REC_BAR_COUNT];
+	struct rec_wave wave; /* all volume columns, drawn by one object */
 	lv_obj_t *rec_dot;
 	lv_obj_t *rec_mute_label;
-	uint8_t rec_volume; /* 0..100 simulated mic level */
-
-	struct {
-		uint8_t target_half_h;
-		uint8_t target_opa;
-	} bar_meta[REC_BAR_COUNT];
-	int rec_scroll_px;
+	uint8_t rec_volume; /* 0..100 mic level from the audio meter */
 
 	/* Timers */
-	lv_timer_t *tick_timer;
 	lv_timer_t *bars_timer;
 	lv_timer_t *timestamp_timer;
 
@@ -256,7 +106,9 @@ struct ui_ctx {
 	uint32_t scene_start_ms;
 	uint32_t battery_pct;
 	bool charging;
+	uint8_t wire_state; /* 0 disconnected, 1 connected, 2 BT TX, 3 WiFi TX */
 	bool info_enh_mode;
+	bool pending_audio;
 	bool start_rec_switched;
 };
 
@@ -269,41 +121,6 @@ static struct ui_ctx g_ui;
 #define UI_FG lv_color_make(0xFF, 0xFF, 0xFF)
 #define UI_BG lv_color_make(0x00, 0x00, 0x00)
 
-static lv_obj_t *ui_rect(lv_obj_t *parent, int x, int y, int w, int h, lv_color_t c)
-{
-	lv_obj_t *r = lv_obj_create(parent);
-	if (!r) {
-		return NULL;
-	}
-	lv_obj_set_size(r, w, h);
-	lv_obj_set_pos(r, x, y);
-	lv_obj_set_style_radius(r, 0, 0);
-	lv_obj_set_style_border_width(r, 0, 0);
-	lv_obj_set_style_pad_all(r, 0, 0);
-	lv_obj_set_style_bg_opa(r, LV_OPA_COVER, 0);
-	lv_obj_set_style_bg_color(r, c, 0);
-	lv_obj_clear_flag(r, LV_OBJ_FLAG_SCROLLABLE);
-	return r;
-}
-
-static lv_obj_t *ui_tile(lv_obj_t *parent, int x, int y)
-{
-	/* Opaque black tile to ensure clean redraws on 1bpp / VTILED drivers. */
-	lv_obj_t *t = lv_obj_create(parent);
-	if (!t) {
-		return NULL;
-	}
-	lv_obj_set_size(t, INFO_ICON_SIZE, INFO_ICON_SIZE);
-	lv_obj_set_pos(t, x, y);
-	lv_obj_set_style_radius(t, 0, 0);
-	lv_obj_set_style_border_width(t, 0, 0);
-	lv_obj_set_style_pad_all(t, 0, 0);
-	lv_obj_set_style_bg_opa(t, LV_OPA_COVER, 0);
-	lv_obj_set_style_bg_color(t, UI_BG, 0);
-	lv_obj_clear_flag(t, LV_OBJ_FLAG_SCROLLABLE);
-	return t;
-}
-
 static void ui_page_bg(lv_obj_t *cont)
 {
 	/* Force each scene container to fully overwrite previous content.
@@ -320,46 +137,225 @@ static void ui_label_fg(lv_obj_t *label)
 	lv_obj_set_style_text_color(label, UI_FG, 0);
 }
 
-static void ui_icon_clear_wire_states(struct ui_ctx *ui)
+static lv_obj_t *ui_label(lv_obj_t *parent, const char *text, const lv_font_t *font, int h,
+			  int y)
 {
-	lv_obj_add_flag(ui->wire_state_disconnected, LV_OBJ_FLAG_HIDDEN);
-	lv_obj_add_flag(ui->wire_state_connected, LV_OBJ_FLAG_HIDDEN);
-	lv_obj_add_flag(ui->wire_state_bt_tx, LV_OBJ_FLAG_HIDDEN);
-	lv_obj_add_flag(ui->wire_state_wifi_tx, LV_OBJ_FLAG_HIDDEN);
+	lv_obj_t *label = lv_label_create(parent);
+	if (!label) {
+		return NULL;
+	}
+	lv_label_set_text(label, text);
+	lv_obj_set_width(label, OLED_W);
+	lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+	lv_obj_set_style_text_font(label, font, 0);
+	lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+	ui_label_fg(label);
+	lv_obj_set_height(label, h);
+	lv_obj_align(label, LV_ALIGN_TOP_MID, 0, y);
+	return label;
 }
 
-static void ui_icon_set_wire_state(struct ui_ctx *ui, uint32_t state)
+/* ---- INFO icons: pre-rendered tiles from info_icon_atlas.h ---- */
+
+/* Point img at a tile; unchanged tiles are not invalidated. */
+static void ui_icon_set(lv_obj_t *img, enum info_icon icon)
 {
-	ui_icon_clear_wire_states(ui);
-	switch (state) {
-	case 0:
-		lv_obj_clear_flag(ui->wire_state_disconnected, LV_OBJ_FLAG_HIDDEN);
-		break;
-	case 1:
-		lv_obj_clear_flag(ui->wire_state_connected, LV_OBJ_FLAG_HIDDEN);
-		break;
-	case 2:
-		lv_obj_clear_flag(ui->wire_state_bt_tx, LV_OBJ_FLAG_HIDDEN);
-		break;
-	default:
-		lv_obj_clear_flag(ui->wire_state_wifi_tx, LV_OBJ_FLAG_HIDDEN);
-		break;
+	const void *src = &info_icon_img[icon];
+
+	if (lv_image_get_src(img) != src) {
+		lv_image_set_src(img, src);
+	}
+}
+
+/*
+ * Show the current state on the INFO icons. Each icon is one image object;
+ * a state change only swaps its atlas tile, so it invalidates that tile and
+ * nothing else.
+ */
+static void ui_info_update(struct ui_ctx *ui)
+{
+	uint32_t pct = MIN(ui->battery_pct, 100U);
+	uint32_t level = (pct * (INFO_ATLAS_BAT_LEVELS - 1U) + 50U) / 100U;
+	uint32_t wire = MIN(ui->wire_state, INFO_ICON_WIRE_WIFI_TX - INFO_ICON_WIRE_DISCONNECTED);
+
+	ui_icon_set(ui->bat_img,
+		    (ui->charging ? INFO_ICON_BAT_CHG_L0 : INFO_ICON_BAT_L0) + level);
+	ui_icon_set(ui->wire_img, INFO_ICON_WIRE_DISCONNECTED + wire);
+	ui_icon_set(ui->mode_img, ui->info_enh_mode ? INFO_ICON_MODE_ENH : INFO_ICON_MODE_NORMAL);
+	ui_icon_set(ui->pending_img, INFO_ICON_PENDING);
+	if (ui->pending_audio) {
+		lv_obj_clear_flag(ui->pending_img, LV_OBJ_FLAG_HIDDEN);
+	} else {
+		lv_obj_add_flag(ui->pending_img, LV_OBJ_FLAG_HIDDEN);
+	}
+}
+
+/* ---- Pages: built on scene entry, deleted (or parked) on exit ---- */
+
+BUILD_ASSERT(INFO_ATLAS_TILE_W == INFO_ICON_SIZE && INFO_ATLAS_TILE_H == INFO_ICON_SIZE,
+	     "regenerate info_icon_atlas.h for the INFO tile size");
+
+static lv_obj_t *ui_icon_create(lv_obj_t *parent, int slot)
+{
+	lv_obj_t *img = lv_image_create(parent);
+	if (!img) {
+		return NULL;
+	}
+	lv_obj_set_pos(img, INFO_ROW_X0 + slot * (INFO_ICON_SIZE + INFO_ICON_GAP), INFO_ROW_Y);
+	return img;
+}
+
+static int ui_page_info_build(struct ui_ctx *ui, lv_obj_t *cont)
+{
+	/* Battery, wireless, mode, pending audio; tiles set by ui_info_update(). */
+	ui->bat_img = ui_icon_create(cont, 0);
+	ui->wire_img = ui_icon_create(cont, 1);
+	ui->mode_img = ui_icon_create(cont, 2);
+	ui->pending_img = ui_icon_create(cont, 3);
+	if (!ui->bat_img || !ui->wire_img || !ui->mode_img || !ui->pending_img) {
+		return -ENOMEM;
+	}
+	return 0;
+}
+
+static void ui_page_info_forget(struct ui_ctx *ui)
+{
+	ui->bat_img = NULL;
+	ui->wire_img = NULL;
+	ui->mode_img = NULL;
+	ui->pending_img = NULL;
+}
+
+static int ui_page_mute_build(struct ui_ctx *ui, lv_obj_t *cont)
+{
+	ARG_UNUSED(ui);
+
+	if (!ui_label(cont, "MUTE", &lv_font_montserrat_14, 16, 6) ||
+	    !ui_label(cont, "STBY", &lv_font_montserrat_12, 14, 28)) {
+		return -ENOMEM;
+	}
+	return 0;
+}
+
+static int ui_page_rec_build(struct ui_ctx *ui, lv_obj_t *cont)
+{
+	/* Volume bars: one object draws all columns that scroll left */
+	if (!rec_wave_create(&ui->wave, cont, UI_FG)) {
+		return -ENOMEM;
+	}
+
+	ui->rec_dot = lv_obj_create(cont);
+	if (!ui->rec_dot) {
+		return -ENOMEM;
+	}
+	lv_obj_set_size(ui->rec_dot, 8, 8);
+	lv_obj_set_style_radius(ui->rec_dot, LV_RADIUS_CIRCLE, 0);
+	lv_obj_set_style_border_width(ui->rec_dot, 0, 0);
+	lv_obj_set_style_bg_opa(ui->rec_dot, LV_OPA_COVER, 0);
+	lv_obj_set_style_bg_color(ui->rec_dot, UI_FG, 0);
+	lv_obj_set_pos(ui->rec_dot, (OLED_W / 2) - 4, (OLED_H / 2) - 4);
+
+	ui->rec_mute_label = ui_label(cont, "MUTE", &lv_font_montserrat_12, 16, 2);
+	if (!ui->rec_mute_label) {
+		return -ENOMEM;
 	}
+	lv_obj_add_flag(ui->rec_mute_label, LV_OBJ_FLAG_HIDDEN);
+	return 0;
+}
+
+static void ui_page_rec_forget(struct ui_ctx *ui)
+{
+	ui->wave.obj = NULL;
+	ui->rec_dot = NULL;
+	ui->rec_mute_label = NULL;
 }
 
-static void ui_hide_all(struct ui_ctx *ui)
+/*
+ * Page descriptors. Only the shown page's objects live in the LVGL pool,
+ * which is what lets CONFIG_LV_Z_MEM_POOL_SIZE stay small. With
+ * CONFIG_RESPEAKER_UI_PAGE_CACHE, pages marked keep are hidden instead of
+ * deleted after first use: the recording page is revisited on every long
+ * press and is cheap to keep (four objects).
+ */
+struct ui_page_desc {
+	int (*build)(struct ui_ctx *ui, lv_obj_t *cont);
+	void (*forget)(struct ui_ctx *ui); /* drop pointers into a deleted page */
+	bool keep;
+};
+
+static const struct ui_page_desc ui_pages[UI_PAGE_COUNT] = {
+	[UI_PAGE_INFO] = { ui_page_info_build, ui_page_info_forget, false },
+	[UI_PAGE_MUTE] = { ui_page_mute_build, NULL, false },
+	[UI_PAGE_REC] = { ui_page_rec_build, ui_page_rec_forget, true },
+};
+
+static void ui_page_release(struct ui_ctx *ui, enum ui_page page)
+{
+	lv_obj_t *cont = ui->page_cont[page];
+
+	if (!cont) {
+		return;
+	}
+	if (IS_ENABLED(CONFIG_RESPEAKER_UI_PAGE_CACHE) && ui_pages[page].keep) {
+		lv_obj_add_flag(cont, LV_OBJ_FLAG_HIDDEN);
+		return;
+	}
+	lv_obj_del(cont);
+	ui->page_cont[page] = NULL;
+	if (ui_pages[page].forget) {
+		ui_pages[page].forget(ui);
+	}
+}
+
+/* Show page (building it if needed) and release the previous one. On OOM
+ * the screen is left black and -ENOMEM is returned.
+ */
+static int ui_page_show(struct ui_ctx *ui, enum ui_page page)
 {
-	lv_obj_add_flag(ui->info_cont, LV_OBJ_FLAG_HIDDEN);
-	lv_obj_add_flag(ui->mute_cont, LV_OBJ_FLAG_HIDDEN);
-	lv_obj_add_flag(ui->rec_cont, LV_OBJ_FLAG_HIDDEN);
+	lv_obj_t *cont;
+	int ret;
+
+	if (ui->page != page) {
+		ui_page_release(ui, ui->page);
+		ui->page = UI_PAGE_NONE;
+	}
+	if (page == UI_PAGE_NONE) {
+		return 0;
+	}
+
+	cont = ui->page_cont[page];
+	if (!cont) {
+		cont = lv_obj_create(ui->root);
+		if (!cont) {
+			LOG_ERR("UI: page %d OOM", (int)page);
+			return -ENOMEM;
+		}
+		lv_obj_set_size(cont, OLED_W, OLED_H);
+		ui_page_bg(cont);
+
+		ret = ui_pages[page].build(ui, cont);
+		if (ret != 0) {
+			LOG_ERR("UI: page %d OOM", (int)page);
+			lv_obj_del(cont);
+			if (ui_pages[page].forget) {
+				ui_pages[page].forget(ui);
+			}
+			return ret;
+		}
+		ui->page_cont[page] = cont;
+	}
+
+	lv_obj_clear_flag(cont, LV_OBJ_FLAG_HIDDEN);
+	ui->page = page;
+	return 0;
 }
 
 static void ui_stop_timers(struct ui_ctx *ui);
 
 static void ui_anim_black(struct ui_ctx *ui)
 {
-	ui_hide_all(ui);
 	ui_stop_timers(ui);
+	(void)ui_page_show(ui, UI_PAGE_NONE);
 	/* Ensure the screen stays black. */
 	lv_obj_invalidate(lv_screen_active());
 }
@@ -386,186 +382,89 @@ static uint32_t prng_u32(void)
 	return s;
 }
 
-static void anim_set_bg_opa(void *obj, int32_t v)
+static uint8_t rec_gen_half_h(void)
 {
-	lv_obj_set_style_bg_opa((lv_obj_t *)obj, (lv_opa_t)v, 0);
-}
-
-static void rec_gen_bar(struct ui_ctx *ui, int idx)
-{
-	uint32_t r = prng_u32();
 	uint32_t span = (uint32_t)(REC_MAX_HALF_H - REC_MIN_HALF_H + 1);
-	ui->bar_meta[idx].target_half_h = (uint8_t)(REC_MIN_HALF_H + (r % span));
-	/* NOTE: LV_COLOR_DEPTH_1 has no real brightness; keep for future use. */
-	ui->bar_meta[idx].target_opa = (uint8_t)LV_OPA_COVER;
+
+	return (uint8_t)(REC_MIN_HALF_H + (prng_u32() % span));
 }
 
 static void bars_timer_cb(lv_timer_t *t)
 {
 	LV_UNUSED(t);
 	struct ui_ctx *ui = &g_ui;
-	const int center_x = OLED_W / 2;
-	const int mid_y = OLED_H / 2;
 
-	/* Simulate incoming mic volume continuously. */
-	ui->rec_volume = (uint8_t)(prng_u32() % (REC_VOL_MAX + 1));
+	/* Loudest block since the last tick; hold the level if none arrived. */
+	struct audio_meter_sample level;
 
-	/* Pixel-scroll to the left. Wrap every REC_BAR_PITCH px and generate a new
-	 * column at the right edge.
-	 */
-	ui->rec_scroll_px -= 1;
-	if (ui->rec_scroll_px <= -REC_BAR_PITCH) {
-		ui->rec_scroll_px += REC_BAR_PITCH;
-		for (int i = 0; i < (REC_BAR_COUNT - 1); i++) {
-			ui->bar_meta[i] = ui->bar_meta[i + 1];
-		}
-		rec_gen_bar(ui, REC_BAR_COUNT - 1);
+	if (audio_meter_drain(&level)) {
+		ui->rec_volume = audio_meter_level(level.peak);
 	}
 
-	for (int i = 0; i < REC_BAR_COUNT; i++) {
-		lv_obj_t *o = ui->bars[i];
-		int x = (i * REC_BAR_PITCH) + ui->rec_scroll_px;
-
-		if ((x < -REC_BAR_W_MAX) || (x >= OLED_W)) {
-			lv_obj_add_flag(o, LV_OBJ_FLAG_HIDDEN);
-			continue;
-		}
-		lv_obj_clear_flag(o, LV_OBJ_FLAG_HIDDEN);
-		/* Monochrome: always draw fully opaque (avoid dithering/threshold issues). */
-		lv_obj_set_style_bg_opa(o, LV_OPA_COVER, 0);
-
-		/* Width scales with volume on the left side only. Keep dots unchanged. */
-		int w = REC_BAR_W;
-		if (x < center_x) {
-			w = REC_BAR_W + ((REC_BAR_W_MAX - REC_BAR_W) * (int)ui->rec_volume) / REC_VOL_MAX;
-			if (w < REC_BAR_W) {
-				w = REC_BAR_W;
-			} else if (w > REC_BAR_W_MAX) {
-				w = REC_BAR_W_MAX;
-			}
-		}
-		/* Center the column inside the pitch cell so width changes don't cause jitter. */
-		int inner_x = x + ((REC_BAR_PITCH - w) / 2);
-
-		/* Dot on the right half; expand into symmetric bar after crossing center. */
-		if (x >= center_x) {
-			int h = REC_DOT_H;
-			int y = mid_y - (h / 2);
-			lv_obj_set_size(o, REC_BAR_W, h);
-			lv_obj_set_pos(o, x, y);
-			continue;
-		}
-
-		int dx = center_x - x;
-		int k = (dx > REC_GROW_RANGE_PX) ? REC_GROW_RANGE_PX : dx;
-		int target_half = (int)ui->bar_meta[i].target_half_h;
-		int half = (target_half * k) / REC_GROW_RANGE_PX;
-		/* Modulate height by current volume (0..100). */
-		half = (half * (int)ui->rec_volume) / REC_VOL_MAX;
-		if (half < 1) {
-			half = 1;
-		}
-		int h = half * 2;
-		int y = mid_y - half;
-
-		lv_obj_set_size(o, w, h);
-		lv_obj_set_pos(o, inner_x, y);
+	/* Pixel-scroll to the left; a new column enters at the right edge. */
+	if (rec_wave_scroll(&ui->wave)) {
+		rec_wave_push(&ui->wave, rec_gen_half_h());
 	}
-}
-
-static void dot_blink_once(lv_obj_t *dot)
-{
-	lv_anim_t a;
-	lv_anim_init(&a);
-	lv_anim_set_var(&a, dot);
-	lv_anim_set_time(&a, 250);
-	lv_anim_set_playback_time(&a, 250);
-	lv_anim_set_repeat_count(&a, 1);
-	lv_anim_set_values(&a, LV_OPA_30, LV_OPA_COVER);
-	lv_anim_set_exec_cb(&a, anim_set_bg_opa);
-	lv_anim_start(&a);
+	rec_wave_set_volume(&ui->wave, ui->rec_volume);
 }
 
 static void timestamp_timer_cb(lv_timer_t *t)
 {
 	LV_UNUSED(t);
 	struct ui_ctx *ui = &g_ui;
-	/* Timestamp action: blink the dot only (no text). */
-	dot_blink_once(ui->rec_dot);
+
+	/* Timestamp action: toggle the dot once per second (no text). A hard
+	 * on/off step instead of an opacity fade keeps the scene at one frame
+	 * per second; fade steps are not visible at 1bpp anyway.
+	 */
+	if (lv_obj_has_flag(ui->rec_dot, LV_OBJ_FLAG_HIDDEN)) {
+		lv_obj_clear_flag(ui->rec_dot, LV_OBJ_FLAG_HIDDEN);
+	} else {
+		lv_obj_add_flag(ui->rec_dot, LV_OBJ_FLAG_HIDDEN);
+	}
 }
 
 static void ui_anim_info_page(struct ui_ctx *ui)
 {
-	ui_hide_all(ui);
 	ui_stop_timers(ui);
-	lv_obj_clear_flag(ui->info_cont, LV_OBJ_FLAG_HIDDEN);
-
-	/* Static status indicator page (no animations, no state cycling). */
-	ui->battery_pct = 100;
-	ui->charging = false;
-
-	/* Battery fill (no percentage text) */
-	/* New battery geometry uses a fixed 10px inner width. */
-	uint32_t inner_w = 10U;
-	uint32_t fill_w = (inner_w * ui->battery_pct) / 100U;
-	if (fill_w > inner_w) {
-		fill_w = inner_w;
-	}
-	lv_obj_set_width(ui->bat_fill, (int)fill_w);
-
-	/* Charging indicator hidden on static page */
-	lv_obj_add_flag(ui->bat_charge_a, LV_OBJ_FLAG_HIDDEN);
-	lv_obj_add_flag(ui->bat_charge_b, LV_OBJ_FLAG_HIDDEN);
-
-	/* Wireless: disconnected */
-	ui_icon_set_wire_state(ui, 0);
-
-	/* Mode: normal/enhanced (toggled by double-press on INFO page) */
-	if (ui->info_enh_mode) {
-		lv_obj_add_flag(ui->mode_normal, LV_OBJ_FLAG_HIDDEN);
-		lv_obj_clear_flag(ui->mode_enh, LV_OBJ_FLAG_HIDDEN);
-	} else {
-		lv_obj_clear_flag(ui->mode_normal, LV_OBJ_FLAG_HIDDEN);
-		lv_obj_add_flag(ui->mode_enh, LV_OBJ_FLAG_HIDDEN);
+	if (ui_page_show(ui, UI_PAGE_INFO) != 0) {
+		return;
 	}
 
-	/* Pending audio: none */
-	lv_obj_add_flag(ui->pending_icon, LV_OBJ_FLAG_HIDDEN);
+	/* Status indicator page (no animations): battery and link follow their
+	 * bus events, the mode icon follows info_enh_mode (double-press on INFO).
+	 */
+	ui_info_update(ui);
 }
 
 static void ui_anim_standby_mute(struct ui_ctx *ui)
 {
-	ui_hide_all(ui);
 	ui_stop_timers(ui);
-	lv_obj_clear_flag(ui->mute_cont, LV_OBJ_FLAG_HIDDEN);
+	(void)ui_page_show(ui, UI_PAGE_MUTE);
 }
 
 static void ui_anim_start_recording(struct ui_ctx *ui)
 {
-	ui_hide_all(ui);
 	ui_stop_timers(ui);
-	lv_obj_clear_flag(ui->rec_cont, LV_OBJ_FLAG_HIDDEN);
+	if (ui_page_show(ui, UI_PAGE_REC) != 0) {
+		return;
+	}
 	LOG_ERR("UI: START_RECORDING");
 
 	/* Scrolling volume columns for the whole scene. */
-	ui->rec_scroll_px = 0;
 	ui->rec_volume = 0;
 	for (int i = 0; i < REC_BAR_COUNT; i++) {
-		rec_gen_bar(ui, i);
-	}
-
-	for (int i = 0; i < REC_BAR_COUNT; i++) {
-		lv_obj_clear_flag(ui->bars[i], LV_OBJ_FLAG_HIDDEN);
-		lv_obj_set_style_bg_color(ui->bars[i], UI_FG, 0);
-		lv_obj_set_style_bg_opa(ui->bars[i], LV_OPA_COVER, 0);
+		ui->wave.half_h[i] = rec_gen_half_h();
 	}
+	rec_wave_reset(&ui->wave);
+	lv_obj_clear_flag(ui->wave.obj, LV_OBJ_FLAG_HIDDEN);
 	lv_obj_add_flag(ui->rec_dot, LV_OBJ_FLAG_HIDDEN);
 	if (ui->rec_mute_label) {
 		lv_obj_add_flag(ui->rec_mute_label, LV_OBJ_FLAG_HIDDEN);
 	}
 	ui->start_rec_switched = false;
 
-	ui->bars_timer = lv_timer_create(bars_timer_cb, 80, ui);
+	ui->bars_timer = lv_timer_create(bars_timer_cb, UI_BARS_PERIOD_MS, ui);
 	if (!ui->bars_timer) {
 		LOG_ERR("UI: bars_timer OOM");
 		/* Fallback: show a visible marker so the user sees something. */
@@ -573,25 +472,24 @@ static void ui_anim_start_recording(struct ui_ctx *ui)
 		lv_obj_set_style_bg_color(ui->rec_dot, UI_FG, 0);
 		lv_obj_set_style_bg_opa(ui->rec_dot, LV_OPA_COVER, 0);
 		lv_obj_set_pos(ui->rec_dot, (OLED_W / 2) - 4, (OLED_H / 2) - 4);
-		lv_obj_invalidate(ui->rec_cont);
+		lv_obj_invalidate(ui->page_cont[UI_PAGE_REC]);
 		return;
 	}
 
 	/* Apply one immediate layout update so the first frame isn't stale. */
 	bars_timer_cb(NULL);
-	lv_obj_invalidate(ui->rec_cont);
+	lv_obj_invalidate(ui->page_cont[UI_PAGE_REC]);
 }
 
 static void ui_anim_recording_mute(struct ui_ctx *ui)
 {
-	ui_hide_all(ui);
 	ui_stop_timers(ui);
-	lv_obj_clear_flag(ui->rec_cont, LV_OBJ_FLAG_HIDDEN);
+	if (ui_page_show(ui, UI_PAGE_REC) != 0) {
+		return;
+	}
 
 	/* Show dot (recording), and gradually "mute" it by lowering opacity. */
-	for (int i = 0; i < REC_BAR_COUNT; i++) {
-		lv_obj_add_flag(ui->bars[i], LV_OBJ_FLAG_HIDDEN);
-	}
+	lv_obj_add_flag(ui->wave.obj, LV_OBJ_FLAG_HIDDEN);
 	lv_obj_clear_flag(ui->rec_dot, LV_OBJ_FLAG_HIDDEN);
 
 	/* Keep it persistent and visible on mono OLEDs. */
@@ -604,13 +502,12 @@ static void ui_anim_recording_mute(struct ui_ctx *ui)
 
 static void ui_anim_timestamp(struct ui_ctx *ui)
 {
-	ui_hide_all(ui);
 	ui_stop_timers(ui);
-	lv_obj_clear_flag(ui->rec_cont, LV_OBJ_FLAG_HIDDEN);
-
-	for (int i = 0; i < REC_BAR_COUNT; i++) {
-		lv_obj_add_flag(ui->bars[i], LV_OBJ_FLAG_HIDDEN);
+	if (ui_page_show(ui, UI_PAGE_REC) != 0) {
+		return;
 	}
+
+	lv_obj_add_flag(ui->wave.obj, LV_OBJ_FLAG_HIDDEN);
 	lv_obj_clear_flag(ui->rec_dot, LV_OBJ_FLAG_HIDDEN);
 	lv_obj_set_style_bg_opa(ui->rec_dot, LV_OPA_COVER, 0);
 	if (ui->rec_mute_label) {
@@ -618,11 +515,78 @@ static void ui_anim_timestamp(struct ui_ctx *ui)
 	}
 
 	/* Every second: blink dot only. */
-	ui->timestamp_timer = lv_timer_create(timestamp_timer_cb, 1000, ui);
+	ui->timestamp_timer = lv_timer_create(timestamp_timer_cb, UI_TIMESTAMP_PERIOD_MS, ui);
+}
+
+/*
+ * Refresh governor: LVGL display refresh period per scene, replacing the
+ * global CONFIG_LV_DEF_REFR_PERIOD ceiling. Only the recording bars move
+ * continuously; the timestamp dot changes once per second; black, INFO and
+ * the mute scenes are static. The refresh timer pauses while nothing is
+ * invalidated, so a static scene costs no frames; it keeps the default
+ * period only so a later invalidation (e.g. the INFO mode toggle) is shown
+ * promptly.
+ */
+static const uint16_t ui_refr_period_ms[UI_SCENE_COUNT] = {
+	[UI_SCENE_BLACK] = UI_REFR_ON_DEMAND_MS,
+	[UI_SCENE_INFO] = UI_REFR_ON_DEMAND_MS,
+	[UI_SCENE_STANDBY_MUTE] = UI_REFR_ON_DEMAND_MS,
+	[UI_SCENE_START_RECORDING] = UI_REFR_BARS_MS,
+	[UI_SCENE_RECORDING_MUTE] = UI_REFR_ON_DEMAND_MS,
+	[UI_SCENE_TIMESTAMP] = UI_TIMESTAMP_PERIOD_MS,
+};
+
+static void ui_refr_governor_apply(lv_display_t *disp, enum ui_scene scene)
+{
+	lv_timer_t *refr = disp ? lv_display_get_refr_timer(disp) : NULL;
+
+	if (!refr || scene >= UI_SCENE_COUNT) {
+		return;
+	}
+	lv_timer_set_period(refr, ui_refr_period_ms[scene]);
+}
+
+#ifdef CONFIG_RESPEAKER_UI_MEM_STATS
+/*
+ * LVGL pool use once a scene is built and drawn. max_used is the high-water
+ * mark since boot, which is what CONFIG_LV_Z_MEM_POOL_SIZE has to cover.
+ */
+static void ui_mem_report(enum ui_scene scene)
+{
+	lv_mem_monitor_t mon;
+
+	lv_mem_monitor(&mon);
+	LOG_INF("scene %d mem: used %u/%u B (%u%%), max %u B, biggest free %u B, frag %u%%",
+		(int)scene, (unsigned int)(mon.total_size - mon.free_size),
+		(unsigned int)mon.total_size, (unsigned int)mon.used_pct,
+		(unsigned int)mon.max_used, (unsigned int)mon.free_biggest_size,
+		(unsigned int)mon.frag_pct);
+}
+#else
+static inline void ui_mem_report(enum ui_scene scene)
+{
+	ARG_UNUSED(scene);
+}
+#endif /* CONFIG_RESPEAKER_UI_MEM_STATS */
+
+static bool ui_scene_is_recording(enum ui_scene scene)
+{
+	return scene == UI_SCENE_START_RECORDING || scene == UI_SCENE_RECORDING_MUTE ||
+	       scene == UI_SCENE_TIMESTAMP;
 }
 
 static void ui_scene_enter(struct ui_ctx *ui, enum ui_scene scene)
 {
+	lv_display_t *disp = lv_display_get_default();
+	const bool was_recording = ui_scene_is_recording(ui->scene);
+
+	/* The level meter only runs while a recording scene shows it. */
+	if (ui_scene_is_recording(scene) && !was_recording) {
+		audio_meter_start();
+	} else if (!ui_scene_is_recording(scene) && was_recording) {
+		audio_meter_stop();
+	}
+
 	ui->scene = scene;
 	ui->scene_start_ms = k_uptime_get_32();
 
@@ -649,50 +613,110 @@ static void ui_scene_enter(struct ui_ctx *ui, enum ui_scene scene)
 		ui_anim_info_page(ui);
 		break;
 	}
+
+	/* Send the complete new scene as one frame right away, then switch the
+	 * refresh period. A slow period must never leave the old scene (or half
+	 * of the new one) on the panel until its first tick.
+	 */
+	lv_refr_now(disp);
+	ui_refr_governor_apply(disp, scene);
+	ui_mem_report(scene);
 }
 
-static void ui_tick_cb(lv_timer_t *t)
+static void ui_handle_button(struct ui_ctx *ui, button_event_t button)
 {
-	LV_UNUSED(t);
-	struct ui_ctx *ui = &g_ui;
+	switch (button) {
+	case BUTTON_EVENT_SHORT_PRESS:
+		/*
+		 * BLACK: short press -> INFO
+		 * INFO: ignored
+		 * RECORDING: ignored
+		 */
+		if (ui->scene == UI_SCENE_BLACK) {
+			ui_scene_enter(ui, UI_SCENE_INFO);
+		}
+		break;
+	case BUTTON_EVENT_DOUBLE_PRESS:
+		/*
+		 * BLACK: double press -> INFO
+		 * INFO: toggle normal/enhanced and refresh UI
+		 * RECORDING: ignored
+		 */
+		if (ui->scene == UI_SCENE_BLACK) {
+			ui_scene_enter(ui, UI_SCENE_INFO);
+		} else if (ui->scene == UI_SCENE_INFO) {
+			ui->info_enh_mode = !ui->info_enh_mode;
+			ui_anim_info_page(ui);
+		}
+		break;
+	case BUTTON_EVENT_LONG_PRESS:
+		/*
+		 * BLACK: long press -> RECORDING
+		 * INFO: long press -> RECORDING
+		 * RECORDING (any recording scene): long press -> INFO
+		 */
+		if (ui_scene_is_recording(ui->scene)) {
+			ui_scene_enter(ui, UI_SCENE_INFO);
+		} else if (ui->scene == UI_SCENE_BLACK || ui->scene == UI_SCENE_INFO) {
+			ui_scene_enter(ui, UI_SCENE_START_RECORDING);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static void ui_handle_mute(struct ui_ctx *ui, bool muted)
+{
+	/*
+	 * Mute switch:
+	 * BLACK <-> STANDBY_MUTE
+	 * START_RECORDING / TIMESTAMP -> RECORDING_MUTE -> START_RECORDING
+	 */
+	if (muted) {
+		if (ui->scene == UI_SCENE_BLACK) {
+			ui_scene_enter(ui, UI_SCENE_STANDBY_MUTE);
+		} else if (ui->scene == UI_SCENE_START_RECORDING || ui->scene == UI_SCENE_TIMESTAMP) {
+			ui_scene_enter(ui, UI_SCENE_RECORDING_MUTE);
+		}
+	} else if (ui->scene == UI_SCENE_STANDBY_MUTE) {
+		ui_scene_enter(ui, UI_SCENE_BLACK);
+	} else if (ui->scene == UI_SCENE_RECORDING_MUTE) {
+		ui_scene_enter(ui, UI_SCENE_START_RECORDING);
+	}
+}
+
+static void ui_handle_events(struct ui_ctx *ui)
+{
+	/* Drain the event bus (posting order across classes) and drive the UI. */
+	struct ui_event evt;
 
-	/* Poll button events and drive UI. */
-	button_event_t evt;
-	while (button_get_event_no_wait(&evt) == 0) {
-		switch (evt) {
-		case BUTTON_EVENT_SHORT_PRESS:
-			/*
-			 * BLACK: short press -> INFO
-			 * INFO: ignored
-			 * RECORDING: ignored
-			 */
-			if (ui->scene == UI_SCENE_BLACK) {
-				ui_scene_enter(ui, UI_SCENE_INFO);
+	while (ui_event_get(&evt) == 0) {
+		switch (evt.type) {
+		case UI_EVT_BUTTON:
+			ui_handle_button(ui, evt.button);
+			break;
+		case UI_EVT_MUTE:
+			ui_handle_mute(ui, evt.muted);
+			break;
+		case UI_EVT_BATTERY:
+			ui->battery_pct = evt.battery.pct;
+			ui->charging = evt.battery.charging;
+			if (ui->page == UI_PAGE_INFO) {
+				ui_info_update(ui);
 			}
 			break;
-		case BUTTON_EVENT_DOUBLE_PRESS:
-			/*
-			 * BLACK: double press -> INFO
-			 * INFO: toggle normal/enhanced and refresh UI
-			 * RECORDING: ignored
-			 */
-			if (ui->scene == UI_SCENE_BLACK) {
-				ui_scene_enter(ui, UI_SCENE_INFO);
-			} else if (ui->scene == UI_SCENE_INFO) {
-				ui->info_enh_mode = !ui->info_enh_mode;
-				ui_anim_info_page(ui);
-				lv_obj_invalidate(ui->info_cont);
+		case UI_EVT_LINK:
+			ui->wire_state = evt.link;
+			if (ui->page == UI_PAGE_INFO) {
+				ui_info_update(ui);
 			}
 			break;
-		case BUTTON_EVENT_LONG_PRESS:
-			/*
-			 * BLACK: long press -> RECORDING
-			 * INFO: long press -> RECORDING
-			 * RECORDING: long press -> INFO
-			 */
+		case UI_EVT_REC_MARK:
+			/* A marker flips between the live bars and the timestamp dot. */
 			if (ui->scene == UI_SCENE_START_RECORDING) {
-				ui_scene_enter(ui, UI_SCENE_INFO);
-			} else if (ui->scene == UI_SCENE_BLACK || ui->scene == UI_SCENE_INFO) {
+				ui_scene_enter(ui, UI_SCENE_TIMESTAMP);
+			} else if (ui->scene == UI_SCENE_TIMESTAMP) {
 				ui_scene_enter(ui, UI_SCENE_START_RECORDING);
 			}
 			break;
@@ -713,13 +737,9 @@ static int ui_create_recording_demo(struct ui_ctx *ui)
 	lv_obj_set_style_border_width(scr, 0, 0);
 	lv_obj_set_style_pad_all(scr, 0, 0);
 
-	/* If we fail part-way through, delete the root to free any created children. */
-	ui->root = NULL;
-	ui->info_cont = NULL;
-	ui->mute_cont = NULL;
-	ui->rec_cont = NULL;
-	ui->rec_mute_label = NULL;
-	ui->rec_scroll_px = 0;
+	/* Pages are built by ui_scene_enter(); only the root exists up front. */
+	memset(ui->page_cont, 0, sizeof(ui->page_cont));
+	ui->page = UI_PAGE_NONE;
 
 	ui->root = lv_obj_create(lv_screen_active());
 	if (!ui->root) {
@@ -732,374 +752,246 @@ static int ui_create_recording_demo(struct ui_ctx *ui)
 	lv_obj_set_style_border_width(ui->root, 0, 0);
 	lv_obj_set_style_pad_all(ui->root, 0, 0);
 
-	/* INFO container */
-	ui->info_cont = lv_obj_create(ui->root);
-	if (!ui->info_cont) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
-	lv_obj_set_size(ui->info_cont, OLED_W, OLED_H);
-	ui_page_bg(ui->info_cont);
-
-	/* Battery icon (more standard): terminal + body outline + fill + charge overlay */
-	const int info_y = INFO_ROW_Y;
-	const int x_bat = INFO_ROW_X0;
-	const int x_wire = INFO_ROW_X0 + (INFO_ICON_SIZE + INFO_ICON_GAP);
-	const int x_mode = INFO_ROW_X0 + 2 * (INFO_ICON_SIZE + INFO_ICON_GAP);
-	const int x_pending = INFO_ROW_X0 + 3 * (INFO_ICON_SIZE + INFO_ICON_GAP);
-
-	ui->bat_outline = ui_tile(ui->info_cont, x_bat, info_y);
-	if (!ui->bat_outline) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+	/* Until the first battery/link events: full, not charging, disconnected. */
+	ui->battery_pct = 100;
+	ui->charging = false;
+	ui->wire_state = 0;
+	ui->info_enh_mode = false;
+	ui->pending_audio = false;
+	ui->start_rec_switched = false;
 
-	/* Terminal on top */
-	ui->bat_cap = ui_rect(ui->bat_outline, 7, 3, 6, 3, UI_FG);
-	if (!ui->bat_cap) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+	return 0;
+}
 
-	/* Body outline: 14x11 at (3,6), stroke=INFO_STROKE => inner width 10px */
-	const int bat_x = 3;
-	const int bat_y = 6;
-	const int bat_w = 14;
-	const int bat_h = 11;
-	const int s = INFO_STROKE;
-	if (!ui_rect(ui->bat_outline, bat_x, bat_y, bat_w, s, UI_FG) ||
-	    !ui_rect(ui->bat_outline, bat_x, bat_y, s, bat_h, UI_FG) ||
-	    !ui_rect(ui->bat_outline, bat_x, bat_y + bat_h - s, bat_w, s, UI_FG) ||
-	    !ui_rect(ui->bat_outline, bat_x + bat_w - s, bat_y, s, bat_h, UI_FG)) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+/* Given by the UI event bus; the main loop sleeps on it between LVGL deadlines. */
+K_SEM_DEFINE(ui_wake_sem, 0, 1);
 
-	ui->bat_fill = ui_rect(ui->bat_outline, bat_x + s, bat_y + s, 10, bat_h - (2 * s), UI_FG);
-	/* Charging marker: chunky lightning cut-out (drawn in BG so it appears inside fill) */
-	ui->bat_charge_a = ui_rect(ui->bat_outline, bat_x + 6, bat_y + 2, 3, 3, UI_BG);
-	ui->bat_charge_b = ui_rect(ui->bat_outline, bat_x + 5, bat_y + 5, 5, 3, UI_BG);
-	if (!ui->bat_fill || !ui->bat_charge_a || !ui->bat_charge_b) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
-	lv_obj_add_flag(ui->bat_charge_a, LV_OBJ_FLAG_HIDDEN);
-	lv_obj_add_flag(ui->bat_charge_b, LV_OBJ_FLAG_HIDDEN);
-
-	/* Wireless icon: tile + 4 variants (chunky, rectangle-only, more recognizable) */
-	ui->wire_circle = ui_tile(ui->info_cont, x_wire, info_y);
-	if (!ui->wire_circle) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+#ifdef CONFIG_RESPEAKER_UI_WAKE_STATS
+static uint32_t ui_stats_frames;
 
-	ui->wire_state_disconnected = lv_obj_create(ui->wire_circle);
-	ui->wire_state_connected = lv_obj_create(ui->wire_circle);
-	ui->wire_state_bt_tx = lv_obj_create(ui->wire_circle);
-	ui->wire_state_wifi_tx = lv_obj_create(ui->wire_circle);
-	if (!ui->wire_state_disconnected || !ui->wire_state_connected || !ui->wire_state_bt_tx || !ui->wire_state_wifi_tx) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
-	/* Common init for state containers */
-	{
-		lv_obj_t *states[] = {
-			ui->wire_state_disconnected,
-			ui->wire_state_connected,
-			ui->wire_state_bt_tx,
-			ui->wire_state_wifi_tx,
-		};
-		for (size_t si = 0; si < ARRAY_SIZE(states); si++) {
-			lv_obj_set_size(states[si], INFO_ICON_SIZE, INFO_ICON_SIZE);
-			lv_obj_set_pos(states[si], 0, 0);
-			lv_obj_set_style_bg_opa(states[si], LV_OPA_TRANSP, 0);
-			lv_obj_set_style_border_width(states[si], 0, 0);
-			lv_obj_set_style_pad_all(states[si], 0, 0);
-			lv_obj_clear_flag(states[si], LV_OBJ_FLAG_SCROLLABLE);
-		}
-	}
+static void ui_stats_display_cb(lv_event_t *e)
+{
+	LV_UNUSED(e);
+	ui_stats_frames++;
+}
 
-	/* Disconnected: broken link + slash */
-	{
-		lv_obj_t *l = ui_rect(ui->wire_state_disconnected, 3, 8, 5, 5, UI_FG);
-		lv_obj_t *r = ui_rect(ui->wire_state_disconnected, 12, 8, 5, 5, UI_FG);
-		lv_obj_t *s1 = ui_rect(ui->wire_state_disconnected, 7, 6, 3, 3, UI_FG);
-		lv_obj_t *s2 = ui_rect(ui->wire_state_disconnected, 9, 9, 3, 3, UI_FG);
-		lv_obj_t *s3 = ui_rect(ui->wire_state_disconnected, 11, 12, 3, 3, UI_FG);
-		if (!l || !r || !s1 || !s2 || !s3) {
-			lv_obj_del(ui->root);
-			ui->root = NULL;
-			return -ENOMEM;
-		}
+static void ui_wake_stats_init(lv_display_t *disp)
+{
+	if (disp) {
+		lv_display_add_event_cb(disp, ui_stats_display_cb, LV_EVENT_RENDER_READY, NULL);
 	}
+}
 
-	/* Connected: chain link (two blocks + connector) */
-	{
-		lv_obj_t *l = ui_rect(ui->wire_state_connected, 3, 8, 5, 5, UI_FG);
-		lv_obj_t *r = ui_rect(ui->wire_state_connected, 12, 8, 5, 5, UI_FG);
-		lv_obj_t *c = ui_rect(ui->wire_state_connected, 7, 9, 6, 3, UI_FG);
-		if (!l || !r || !c) {
-			lv_obj_del(ui->root);
-			ui->root = NULL;
-			return -ENOMEM;
-		}
+/* Event bus totals over all event classes. */
+static void ui_wake_stats_events(uint32_t *dropped, uint32_t *coalesced)
+{
+	struct ui_event_stats es;
+
+	*dropped = 0U;
+	*coalesced = 0U;
+	for (int type = 0; type < UI_EVT_TYPE_COUNT; type++) {
+		ui_event_get_stats((enum ui_event_type)type, &es);
+		*dropped += es.dropped;
+		*coalesced += es.coalesced;
 	}
+}
 
-	/* BT TX: link + two "tx" columns */
-	{
-		lv_obj_t *l = ui_rect(ui->wire_state_bt_tx, 3, 8, 5, 5, UI_FG);
-		lv_obj_t *r = ui_rect(ui->wire_state_bt_tx, 12, 8, 5, 5, UI_FG);
-		lv_obj_t *c = ui_rect(ui->wire_state_bt_tx, 7, 9, 6, 3, UI_FG);
-		lv_obj_t *t1 = ui_rect(ui->wire_state_bt_tx, 15, 3, 2, 5, UI_FG);
-		lv_obj_t *t2 = ui_rect(ui->wire_state_bt_tx, 17, 2, 2, 7, UI_FG);
-		if (!l || !r || !c || !t1 || !t2) {
-			lv_obj_del(ui->root);
-			ui->root = NULL;
-			return -ENOMEM;
-		}
-	}
+/* Main-loop wakeups, rendered frames and OLED bus bytes per second, reported
+ * per scene when the scene is left or once per second while it stays;
+ * reporting never adds a wakeup of its own. Bus bytes are the display's
+ * share of the power budget (see the estimates in display/ch1115.h). UI
+ * events dropped or coalesced by the event bus in the window follow.
+ */
+static void ui_wake_stats_count(const struct device *display_dev, enum ui_scene scene)
+{
+	static enum ui_scene win_scene;
+	static uint32_t win_start_ms;
+	static uint32_t win_wakeups;
+	static uint32_t win_frames;
+	static uint32_t win_bytes;
+	static uint32_t win_dropped;
+	static uint32_t win_coalesced;
+	struct ch1115_stats st;
+	uint32_t now = k_uptime_get_32();
+	uint32_t elapsed = now - win_start_ms;
 
-	/* WiFi TX: link + three rising bars */
-	{
-		lv_obj_t *l = ui_rect(ui->wire_state_wifi_tx, 3, 8, 5, 5, UI_FG);
-		lv_obj_t *r = ui_rect(ui->wire_state_wifi_tx, 12, 8, 5, 5, UI_FG);
-		lv_obj_t *c = ui_rect(ui->wire_state_wifi_tx, 7, 9, 6, 3, UI_FG);
-		lv_obj_t *b1 = ui_rect(ui->wire_state_wifi_tx, 14, 4, 2, 4, UI_FG);
-		lv_obj_t *b2 = ui_rect(ui->wire_state_wifi_tx, 16, 3, 2, 6, UI_FG);
-		lv_obj_t *b3 = ui_rect(ui->wire_state_wifi_tx, 18, 2, 2, 8, UI_FG);
-		if (!l || !r || !c || !b1 || !b2 || !b3) {
-			lv_obj_del(ui->root);
-			ui->root = NULL;
-			return -ENOMEM;
-		}
-	}
+	ch1115_get_stats(display_dev, &st);
 
-	ui_icon_clear_wire_states(ui);
-	lv_obj_clear_flag(ui->wire_state_disconnected, LV_OBJ_FLAG_HIDDEN);
+	if (scene != win_scene || elapsed >= 1000U) {
+		uint32_t dropped;
+		uint32_t coalesced;
 
-	/* Mode icon: microphone (normal) vs microphone + gain bars (enhanced) */
-	ui->mode_icon = ui_tile(ui->info_cont, x_mode, info_y);
-	if (!ui->mode_icon) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+		ui_wake_stats_events(&dropped, &coalesced);
 
-	ui->mode_normal = lv_obj_create(ui->mode_icon);
-	if (!ui->mode_normal) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
-	lv_obj_set_size(ui->mode_normal, INFO_ICON_SIZE, INFO_ICON_SIZE);
-	lv_obj_set_pos(ui->mode_normal, 0, 0);
-	lv_obj_set_style_bg_opa(ui->mode_normal, LV_OPA_TRANSP, 0);
-	lv_obj_set_style_border_width(ui->mode_normal, 0, 0);
-	lv_obj_set_style_pad_all(ui->mode_normal, 0, 0);
-	lv_obj_clear_flag(ui->mode_normal, LV_OBJ_FLAG_SCROLLABLE);
-	/* Mic: top cap + body + stem + base */
-	if (!ui_rect(ui->mode_normal, 6, 3, 8, 2, UI_FG) ||
-	    !ui_rect(ui->mode_normal, 7, 5, 6, 9, UI_FG) ||
-	    !ui_rect(ui->mode_normal, 9, 14, 2, 3, UI_FG) ||
-	    !ui_rect(ui->mode_normal, 6, 18, 8, 2, UI_FG)) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+		if (win_start_ms != 0U && elapsed > 0U) {
+			uint32_t frames = ui_stats_frames - win_frames;
 
-	ui->mode_enh = lv_obj_create(ui->mode_icon);
-	if (!ui->mode_enh) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
-	lv_obj_set_size(ui->mode_enh, INFO_ICON_SIZE, INFO_ICON_SIZE);
-	lv_obj_set_pos(ui->mode_enh, 0, 0);
-	lv_obj_set_style_bg_opa(ui->mode_enh, LV_OPA_TRANSP, 0);
-	lv_obj_set_style_border_width(ui->mode_enh, 0, 0);
-	lv_obj_set_style_pad_all(ui->mode_enh, 0, 0);
-	lv_obj_clear_flag(ui->mode_enh, LV_OBJ_FLAG_SCROLLABLE);
-	/* Same mic + side gain bars */
-	if (!ui_rect(ui->mode_enh, 6, 3, 8, 2, UI_FG) ||
-	    !ui_rect(ui->mode_enh, 7, 5, 6, 9, UI_FG) ||
-	    !ui_rect(ui->mode_enh, 9, 14, 2, 3, UI_FG) ||
-	    !ui_rect(ui->mode_enh, 6, 18, 8, 2, UI_FG) ||
-	    !ui_rect(ui->mode_enh, 3, 6, 2, 8, UI_FG) ||
-	    !ui_rect(ui->mode_enh, 15, 6, 2, 8, UI_FG)) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
+			printk("scene %d: %u.%02u wakeups/s, %u.%02u FPS, %u bus B/s, "
+			       "%u events dropped, %u coalesced\n",
+			       (int)win_scene, (win_wakeups * 1000U) / elapsed,
+			       ((win_wakeups * 100000U) / elapsed) % 100U,
+			       (frames * 1000U) / elapsed, ((frames * 100000U) / elapsed) % 100U,
+			       ((st.bytes_sent - win_bytes) * 1000U) / elapsed,
+			       dropped - win_dropped, coalesced - win_coalesced);
+		}
+		win_scene = scene;
+		win_start_ms = now;
+		win_wakeups = 0U;
+		win_frames = ui_stats_frames;
+		win_bytes = st.bytes_sent;
+		win_dropped = dropped;
+		win_coalesced = coalesced;
 	}
-	lv_obj_add_flag(ui->mode_enh, LV_OBJ_FLAG_HIDDEN);
+	win_wakeups++;
+}
+#else
+static inline void ui_wake_stats_init(lv_display_t *disp)
+{
+	ARG_UNUSED(disp);
+}
 
-	/* Pending audio icon: trays + upload arrow */
-	ui->pending_icon = ui_tile(ui->info_cont, x_pending, info_y);
-	if (!ui->pending_icon) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+static inline void ui_wake_stats_count(const struct device *display_dev, enum ui_scene scene)
+{
+	ARG_UNUSED(display_dev);
+	ARG_UNUSED(scene);
+}
+#endif /* CONFIG_RESPEAKER_UI_WAKE_STATS */
 
-	ui->pending_stack_a = lv_obj_create(ui->pending_icon);
-	ui->pending_stack_b = lv_obj_create(ui->pending_icon);
-	ui->pending_arrow = lv_obj_create(ui->pending_icon);
-	if (!ui->pending_stack_a || !ui->pending_stack_b || !ui->pending_arrow) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
+/*
+ * Partial-refresh tuning: round every invalidated area out to whole CH1115
+ * pages (8 rows) and whole I1 bytes (8 columns). Each draw-buffer chunk then
+ * converts to VTILED without partial bytes and lands on whole GDDRAM pages,
+ * so no page is rendered twice by neighbouring chunks. Runs after Zephyr's
+ * own rounder.
+ */
+BUILD_ASSERT((OLED_W % 8) == 0 && (OLED_H % 8) == 0, "panel must be page-aligned");
 
-	/* Trays */
-	lv_obj_set_size(ui->pending_stack_b, 14, 3);
-	lv_obj_set_pos(ui->pending_stack_b, 3, 13);
-	lv_obj_set_style_bg_opa(ui->pending_stack_b, LV_OPA_COVER, 0);
-	lv_obj_set_style_bg_color(ui->pending_stack_b, UI_FG, 0);
-	lv_obj_set_style_border_width(ui->pending_stack_b, 0, 0);
-
-	lv_obj_set_size(ui->pending_stack_a, 14, 3);
-	lv_obj_set_pos(ui->pending_stack_a, 3, 17);
-	lv_obj_set_style_bg_opa(ui->pending_stack_a, LV_OPA_COVER, 0);
-	lv_obj_set_style_bg_color(ui->pending_stack_a, UI_FG, 0);
-	lv_obj_set_style_border_width(ui->pending_stack_a, 0, 0);
-
-	/* Arrow (centered) */
-	lv_obj_set_size(ui->pending_arrow, 3, 9);
-	lv_obj_set_pos(ui->pending_arrow, 9, 5);
-	lv_obj_set_style_bg_opa(ui->pending_arrow, LV_OPA_COVER, 0);
-	lv_obj_set_style_bg_color(ui->pending_arrow, UI_FG, 0);
-	lv_obj_set_style_border_width(ui->pending_arrow, 0, 0);
-	{
-		lv_obj_t *head = lv_obj_create(ui->pending_icon);
-		if (!head) {
-			lv_obj_del(ui->root);
-			ui->root = NULL;
-			return -ENOMEM;
+static void ui_rounder_cb(lv_event_t *e)
+{
+	lv_area_t *area = lv_event_get_param(e);
+
+	area->x1 &= ~7;
+	area->x2 |= 7;
+	area->y1 &= ~7;
+	area->y2 |= 7;
+}
+
+#ifdef CONFIG_RESPEAKER_UI_FRAME_LATENCY
+/*
+ * Frame latency: from LV_EVENT_RENDER_READY (the last chunk is rendered)
+ * to the next LV_EVENT_FLUSH_WAIT_FINISH (LVGL saw the display take it).
+ * A frame whose flush is not waited for before the next render starts is
+ * counted as unobserved instead of binned.
+ */
+static struct frame_hist ui_lat_hist;
+static uint32_t ui_lat_t0;
+static bool ui_lat_pending;
+static uint32_t ui_lat_unobserved;
+
+static void ui_latency_cb(lv_event_t *e)
+{
+	switch (lv_event_get_code(e)) {
+	case LV_EVENT_RENDER_START:
+		if (ui_lat_pending) {
+			ui_lat_unobserved++;
+			ui_lat_pending = false;
 		}
-		lv_obj_set_size(head, 9, 3);
-		lv_obj_set_pos(head, 6, 3);
-		lv_obj_set_style_bg_opa(head, LV_OPA_COVER, 0);
-		lv_obj_set_style_bg_color(head, UI_FG, 0);
-		lv_obj_set_style_border_width(head, 0, 0);
-		lv_obj_clear_flag(head, LV_OBJ_FLAG_SCROLLABLE);
+		break;
+	case LV_EVENT_RENDER_READY:
+		ui_lat_t0 = k_cycle_get_32();
+		ui_lat_pending = true;
+		break;
+	case LV_EVENT_FLUSH_WAIT_FINISH:
+		if (ui_lat_pending) {
+			frame_hist_add(&ui_lat_hist,
+				       k_cyc_to_us_floor32(k_cycle_get_32() - ui_lat_t0));
+			ui_lat_pending = false;
+		}
+		break;
+	default:
+		break;
 	}
+}
 
-	lv_obj_clear_flag(ui->pending_stack_a, LV_OBJ_FLAG_SCROLLABLE);
-	lv_obj_clear_flag(ui->pending_stack_b, LV_OBJ_FLAG_SCROLLABLE);
-	lv_obj_clear_flag(ui->pending_arrow, LV_OBJ_FLAG_SCROLLABLE);
+/* Print the distribution per scene, when the scene is left. */
+static void ui_latency_report(enum ui_scene scene)
+{
+	static enum ui_scene last_scene;
 
-	/* MUTE container */
-	ui->mute_cont = lv_obj_create(ui->root);
-	if (!ui->mute_cont) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
+	if (scene == last_scene) {
+		return;
 	}
-	lv_obj_set_size(ui->mute_cont, OLED_W, OLED_H);
-	ui_page_bg(ui->mute_cont);
+	if (ui_lat_hist.count > 0U || ui_lat_unobserved > 0U) {
+		char name[24];
 
-	lv_obj_t *mute_icon = lv_label_create(ui->mute_cont);
-	if (!mute_icon) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
-	lv_label_set_text(mute_icon, "MUTE");
-	lv_obj_set_width(mute_icon, OLED_W);
-	lv_label_set_long_mode(mute_icon, LV_LABEL_LONG_CLIP);
-	lv_obj_set_style_text_font(mute_icon, &lv_font_montserrat_14, 0);
-	lv_obj_set_style_text_align(mute_icon, LV_TEXT_ALIGN_CENTER, 0);
-	ui_label_fg(mute_icon);
-	lv_obj_set_height(mute_icon, 16);
-	lv_obj_align(mute_icon, LV_ALIGN_TOP_MID, 0, 6);
-
-	lv_obj_t *mute_hint = lv_label_create(ui->mute_cont);
-	if (!mute_hint) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
+		snprintf(name, sizeof(name), "scene %d latency", (int)last_scene);
+		frame_hist_print(&ui_lat_hist, name);
+		printk("%s: %u unobserved\n", name, ui_lat_unobserved);
 	}
-	lv_label_set_text(mute_hint, "STBY");
-	lv_obj_set_width(mute_hint, OLED_W);
-	lv_label_set_long_mode(mute_hint, LV_LABEL_LONG_CLIP);
-	lv_obj_set_style_text_font(mute_hint, &lv_font_montserrat_12, 0);
-	lv_obj_set_style_text_align(mute_hint, LV_TEXT_ALIGN_CENTER, 0);
-	ui_label_fg(mute_hint);
-	lv_obj_set_height(mute_hint, 14);
-	lv_obj_align(mute_hint, LV_ALIGN_TOP_MID, 0, 28);
-
-	/* RECORD container */
-	ui->rec_cont = lv_obj_create(ui->root);
-	if (!ui->rec_cont) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
-	}
-	lv_obj_set_size(ui->rec_cont, OLED_W, OLED_H);
-	ui_page_bg(ui->rec_cont);
+	frame_hist_reset(&ui_lat_hist);
+	ui_lat_unobserved = 0U;
+	last_scene = scene;
+}
+#else
+static inline void ui_latency_report(enum ui_scene scene)
+{
+	ARG_UNUSED(scene);
+}
+#endif /* CONFIG_RESPEAKER_UI_FRAME_LATENCY */
 
-	/* Volume bars: thin columns that scroll left; start as dots centered on midline */
-	const int bar_w = REC_BAR_W;
-	const int bar_pitch = REC_BAR_PITCH;
-	const int mid_y = OLED_H / 2;
-	for (int i = 0; i < REC_BAR_COUNT; i++) {
-		ui->bars[i] = lv_obj_create(ui->rec_cont);
-		if (!ui->bars[i]) {
-			lv_obj_del(ui->root);
-			ui->root = NULL;
-			return -ENOMEM;
-		}
-		lv_obj_set_size(ui->bars[i], bar_w, REC_DOT_H);
-		lv_obj_set_style_radius(ui->bars[i], 0, 0);
-		lv_obj_set_style_border_width(ui->bars[i], 0, 0);
-		lv_obj_set_style_bg_opa(ui->bars[i], LV_OPA_COVER, 0);
-		lv_obj_set_style_bg_color(ui->bars[i], UI_FG, 0);
-		lv_obj_set_pos(ui->bars[i], i * bar_pitch, mid_y - (REC_DOT_H / 2));
+static void ui_display_hooks_init(lv_display_t *disp, const struct device *display_dev)
+{
+	if (!disp) {
+		return;
 	}
-
-	ui->rec_dot = lv_obj_create(ui->rec_cont);
-	if (!ui->rec_dot) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
+	lv_display_add_event_cb(disp, ui_rounder_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+#ifdef CONFIG_RESPEAKER_UI_FRAME_LATENCY
+	frame_hist_reset(&ui_lat_hist);
+	lv_display_add_event_cb(disp, ui_latency_cb, LV_EVENT_ALL, NULL);
+#endif
+	ui_prof_init(disp, display_dev);
+
+#ifdef CONFIG_RESPEAKER_UI_VTILED_FLUSH
+	/* Needs the pixel format already set (MONO10 inverts). */
+	static uint8_t vt_buf[OLED_W * OLED_H / 8];
+	static struct vtiled_flush vt;
+	int ret = vtiled_flush_install(disp, &vt, display_dev, vt_buf, sizeof(vt_buf));
+
+	if (ret < 0) {
+		LOG_ERR("Fast VTILED flush not installed: %d", ret);
 	}
-	lv_obj_set_size(ui->rec_dot, 8, 8);
-	lv_obj_set_style_radius(ui->rec_dot, LV_RADIUS_CIRCLE, 0);
-	lv_obj_set_style_border_width(ui->rec_dot, 0, 0);
-	lv_obj_set_style_bg_opa(ui->rec_dot, LV_OPA_COVER, 0);
-	lv_obj_set_style_bg_color(ui->rec_dot, UI_FG, 0);
-	lv_obj_set_pos(ui->rec_dot, (OLED_W / 2) - 4, (OLED_H / 2) - 4);
+#endif
+}
 
-	ui->rec_mute_label = lv_label_create(ui->rec_cont);
-	if (!ui->rec_mute_label) {
-		lv_obj_del(ui->root);
-		ui->root = NULL;
-		return -ENOMEM;
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE
+/*
+ * Bring-up: find the fastest I2C rate the OLED sustains. With settings the
+ * result is stored once and applied by settings_load() on later boots.
+ */
+static void display_bus_bringup(const struct device *display_dev)
+{
+	struct ch1115_bus_probe_result res;
+	static const char *const verify_names[] = { "ack", "readback", "emul" };
+
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_SETTINGS
+	(void)settings_subsys_init();
+	(void)settings_load();
+	if (ch1115_get_bus_freq(display_dev) != 0U) {
+		printk("OLED bus: stored rate %u Hz\n", ch1115_get_bus_freq(display_dev));
+		return;
 	}
-	lv_label_set_text(ui->rec_mute_label, "MUTE");
-	lv_obj_set_width(ui->rec_mute_label, OLED_W);
-	lv_label_set_long_mode(ui->rec_mute_label, LV_LABEL_LONG_CLIP);
-	lv_obj_set_style_text_font(ui->rec_mute_label, &lv_font_montserrat_12, 0);
-	lv_obj_set_style_text_align(ui->rec_mute_label, LV_TEXT_ALIGN_CENTER, 0);
-	ui_label_fg(ui->rec_mute_label);
-	lv_obj_set_height(ui->rec_mute_label, 16);
-	lv_obj_align(ui->rec_mute_label, LV_ALIGN_TOP_MID, 0, 2);
-	lv_obj_add_flag(ui->rec_mute_label, LV_OBJ_FLAG_HIDDEN);
+#endif
 
-	ui->battery_pct = 87;
-	ui->charging = false;
-	ui->info_enh_mode = false;
-	ui->start_rec_switched = false;
+	int ret = ch1115_bus_probe(display_dev, &res);
 
-	ui_hide_all(ui);
-	return 0;
+	for (uint8_t i = 0; i < res.steps_run; i++) {
+		printk("OLED bus %7u Hz: %s, %u.%u FPS (verify: %s)\n", res.steps[i].freq_hz,
+		       (res.steps[i].err == 0) ? "ok" : "FAIL", res.steps[i].fps_x10 / 10U,
+		       res.steps[i].fps_x10 % 10U, verify_names[res.verify]);
+	}
+	printk("OLED bus: max stable %u Hz (%d)\n", res.max_stable_hz, ret);
 }
+#endif /* CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE */
 
 int main(void)
 {
@@ -1118,12 +1010,14 @@ int main(void)
 	 */
 	(void)display_set_pixel_format(display_dev, PIXEL_FORMAT_MONO10);
 
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE
+	display_bus_bringup(display_dev);
+#endif
+
 	LOG_INF("Starting LVGL app on CH1115 (88x48)");
 
-	/*
-	 * Keep the original FPS stress test code, but do not run it here.
-	 * If you want to use it for benchmarking, call create_ui() instead.
-	 */
+	ui_display_hooks_init(lv_display_get_default(), display_dev);
+
 	int ret = ui_create_recording_demo(&g_ui);
 	if (ret != 0) {
 		LOG_ERR("UI create failed: %d", ret);
@@ -1136,9 +1030,12 @@ int main(void)
 		return 0;
 	}
 
+	/* Panel on + contrast go out as one command transaction. */
+	(void)ch1115_batch_begin(display_dev);
 	(void)display_blanking_off(display_dev);
 	/* Max contrast is noticeably higher power on OLED. */
 	(void)display_set_contrast(display_dev, 0x7F);
+	(void)ch1115_batch_end(display_dev);
 	/* Force one full clear + one lvgl handler to trigger a flush early */
 	(void)display_clear(display_dev);
 
@@ -1148,11 +1045,21 @@ int main(void)
 	ui_scene_enter(&g_ui, UI_SCENE_BLACK);
 	lv_obj_invalidate(lv_screen_active());
 	lv_timer_handler();
-	g_ui.tick_timer = lv_timer_create(ui_tick_cb, 50, &g_ui);
+	ui_event_set_notify(&ui_wake_sem);
+	ui_wake_stats_init(lv_display_get_default());
 
 	while (1) {
-		/* Drive LVGL timers/animations. */
-		lv_timer_handler();
-		k_sleep(K_MSEC(5));
+		/* Drive LVGL timers/animations; returns ms until the next one is due. */
+		uint32_t idle_ms = ui_prof_timer_handler();
+
+		ui_wake_stats_count(display_dev, g_ui.scene);
+		ui_latency_report(g_ui.scene);
+
+		/* Sleep until the next LVGL deadline or until input arrives. Static
+		 * scenes have no running timers, so they sleep until a button event.
+		 */
+		(void)k_sem_take(&ui_wake_sem,
+				 (idle_ms == LV_NO_TIMER_READY) ? K_FOREVER : K_MSEC(idle_ms));
+		ui_handle_events(&g_ui);
 	}
-}
\ No newline at end of file
+}
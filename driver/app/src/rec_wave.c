@@ -0,0 +1,122 @@
+#include "rec_wave.h"
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+/* The object covers only the band bars can reach, so redraws stay inside it. */
+#define REC_BAND_Y ((REC_WAVE_H / 2) - REC_MAX_HALF_H)
+#define REC_BAND_H (2 * REC_MAX_HALF_H)
+
+static void rec_wave_draw_cb(lv_event_t *e)
+{
+	struct rec_wave *w = lv_event_get_user_data(e);
+	lv_layer_t *layer = lv_event_get_layer(e);
+	const int center_x = REC_WAVE_W / 2;
+	lv_area_t coords;
+	lv_draw_rect_dsc_t dsc;
+
+	lv_obj_get_coords(w->obj, &coords);
+	const int mid_y = coords.y1 + REC_MAX_HALF_H;
+
+	lv_draw_rect_dsc_init(&dsc);
+	dsc.bg_color = w->fg;
+	/* Monochrome: always draw fully opaque (avoid dithering/threshold issues). */
+	dsc.bg_opa = LV_OPA_COVER;
+	dsc.radius = 0;
+	dsc.border_width = 0;
+
+	/* Width scales with volume on the left side only. Keep dots unchanged. */
+	int bar_w = REC_BAR_W + ((REC_BAR_W_MAX - REC_BAR_W) * (int)w->volume) / REC_VOL_MAX;
+	bar_w = CLAMP(bar_w, REC_BAR_W, REC_BAR_W_MAX);
+
+	for (int i = 0; i < REC_BAR_COUNT; i++) {
+		int x = (i * REC_BAR_PITCH) + w->scroll_px;
+		lv_area_t a;
+
+		if ((x < -REC_BAR_W_MAX) || (x >= REC_WAVE_W)) {
+			continue;
+		}
+
+		if (x >= center_x) {
+			/* Dot on the right half. */
+			a.x1 = coords.x1 + x;
+			a.x2 = a.x1 + REC_BAR_W - 1;
+			a.y1 = mid_y - (REC_DOT_H / 2);
+			a.y2 = a.y1 + REC_DOT_H - 1;
+		} else {
+			/* Expand into a symmetric bar after crossing the center. */
+			int dx = center_x - x;
+			int k = (dx > REC_GROW_RANGE_PX) ? REC_GROW_RANGE_PX : dx;
+			int half = ((int)w->half_h[i] * k) / REC_GROW_RANGE_PX;
+
+			/* Modulate height by current volume (0..100). */
+			half = (half * (int)w->volume) / REC_VOL_MAX;
+			if (half < 1) {
+				half = 1;
+			}
+
+			/* Center the column inside the pitch cell so width changes don't cause jitter. */
+			a.x1 = coords.x1 + x + ((REC_BAR_PITCH - bar_w) / 2);
+			a.x2 = a.x1 + bar_w - 1;
+			a.y1 = mid_y - half;
+			a.y2 = mid_y + half - 1;
+		}
+
+		lv_draw_rect(layer, &dsc, &a);
+	}
+}
+
+lv_obj_t *rec_wave_create(struct rec_wave *w, lv_obj_t *parent, lv_color_t fg)
+{
+	memset(w, 0, sizeof(*w));
+	w->fg = fg;
+
+	w->obj = lv_obj_create(parent);
+	if (!w->obj) {
+		return NULL;
+	}
+
+	/* Transparent: the page background underneath clears the band. */
+	lv_obj_set_size(w->obj, REC_WAVE_W, REC_BAND_H);
+	lv_obj_set_pos(w->obj, 0, REC_BAND_Y);
+	lv_obj_set_style_bg_opa(w->obj, LV_OPA_TRANSP, 0);
+	lv_obj_set_style_border_width(w->obj, 0, 0);
+	lv_obj_set_style_pad_all(w->obj, 0, 0);
+	lv_obj_set_style_radius(w->obj, 0, 0);
+	lv_obj_clear_flag(w->obj, LV_OBJ_FLAG_SCROLLABLE);
+	lv_obj_clear_flag(w->obj, LV_OBJ_FLAG_CLICKABLE);
+	lv_obj_add_event_cb(w->obj, rec_wave_draw_cb, LV_EVENT_DRAW_MAIN, w);
+
+	return w->obj;
+}
+
+void rec_wave_reset(struct rec_wave *w)
+{
+	w->scroll_px = 0;
+	w->volume = 0;
+	lv_obj_invalidate(w->obj);
+}
+
+bool rec_wave_scroll(struct rec_wave *w)
+{
+	/* Pixel-scroll to the left; wrap every REC_BAR_PITCH px. */
+	w->scroll_px -= 1;
+	if (w->scroll_px > -REC_BAR_PITCH) {
+		return false;
+	}
+
+	w->scroll_px += REC_BAR_PITCH;
+	memmove(&w->half_h[0], &w->half_h[1], REC_BAR_COUNT - 1);
+	return true;
+}
+
+void rec_wave_push(struct rec_wave *w, uint8_t half_h)
+{
+	w->half_h[REC_BAR_COUNT - 1] = half_h;
+}
+
+void rec_wave_set_volume(struct rec_wave *w, uint8_t volume)
+{
+	w->volume = MIN(volume, (uint8_t)REC_VOL_MAX);
+	lv_obj_invalidate(w->obj);
+}
@@ -0,0 +1,68 @@
+#ifndef APP_REC_WAVE_H
+#define APP_REC_WAVE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Recording waveform: one LVGL object that draws every volume column from a
+ * compact array in a single draw callback (instead of one lv_obj per bar).
+ *
+ * Columns scroll left one pixel per step. Right of the centerline they are
+ * dots; after crossing it they grow into symmetric bars whose height follows
+ * the per-column target and the current volume.
+ */
+
+#define REC_WAVE_W 88
+#define REC_WAVE_H 48
+
+#define REC_BAR_W 1
+#define REC_BAR_W_MAX 3
+#define REC_BAR_GAP 4
+#define REC_BAR_PITCH (REC_BAR_W + REC_BAR_GAP)
+#define REC_BAR_COUNT (((REC_WAVE_W + REC_BAR_PITCH - 1) / REC_BAR_PITCH) + 4)
+#define REC_DOT_H 2
+#define REC_MAX_HALF_H 18
+#define REC_MIN_HALF_H 2
+#define REC_GROW_RANGE_PX 14
+
+/* Volume range (0..100). */
+#define REC_VOL_MIN 0
+#define REC_VOL_MAX 100
+
+struct rec_wave {
+	lv_obj_t *obj;
+	lv_color_t fg;
+	int8_t scroll_px;
+	uint8_t volume;
+	uint8_t half_h[REC_BAR_COUNT];
+};
+
+/* Create the widget inside parent, covering the bar band around the midline. */
+lv_obj_t *rec_wave_create(struct rec_wave *w, lv_obj_t *parent, lv_color_t fg);
+
+/* Restart from scroll position 0 with all column targets set by the caller. */
+void rec_wave_reset(struct rec_wave *w);
+
+/*
+ * Scroll one pixel left. Returns true when a column left the screen; the
+ * caller then supplies the target of the new rightmost one with rec_wave_push().
+ */
+bool rec_wave_scroll(struct rec_wave *w);
+
+void rec_wave_push(struct rec_wave *w, uint8_t half_h);
+
+/* Set the current volume and redraw the band. */
+void rec_wave_set_volume(struct rec_wave *w, uint8_t volume);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_REC_WAVE_H */
@@ -0,0 +1,167 @@
+#include "ui_event.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+enum ui_event_policy {
+	UI_EVT_POLICY_DROP_NEWEST,
+	UI_EVT_POLICY_DROP_OLDEST,
+	UI_EVT_POLICY_COALESCE,
+};
+
+#define UI_EVT_BUTTON_DEPTH CONFIG_RESPEAKER_UI_EVENT_BUTTON_DEPTH
+#define UI_EVT_MARK_DEPTH 4U
+
+/* Slot pool: the button queue, one slot per state class, the marker queue. */
+#define UI_EVT_SLOT_MUTE UI_EVT_BUTTON_DEPTH
+#define UI_EVT_SLOT_BATTERY (UI_EVT_SLOT_MUTE + 1U)
+#define UI_EVT_SLOT_LINK (UI_EVT_SLOT_BATTERY + 1U)
+#define UI_EVT_SLOT_MARK (UI_EVT_SLOT_LINK + 1U)
+#define UI_EVT_POOL_SIZE (UI_EVT_SLOT_MARK + UI_EVT_MARK_DEPTH)
+
+struct ui_event_class {
+	struct ui_event *slots;
+	uint8_t depth;
+	uint8_t policy;
+	uint8_t head;
+	uint8_t count;
+	struct ui_event_stats stats;
+};
+
+static struct ui_event ui_evt_pool[UI_EVT_POOL_SIZE];
+
+static struct ui_event_class ui_evt_class[UI_EVT_TYPE_COUNT] = {
+	[UI_EVT_BUTTON] = {
+		.slots = &ui_evt_pool[0],
+		.depth = UI_EVT_BUTTON_DEPTH,
+		.policy = UI_EVT_POLICY_DROP_NEWEST,
+	},
+	[UI_EVT_MUTE] = {
+		.slots = &ui_evt_pool[UI_EVT_SLOT_MUTE],
+		.depth = 1,
+		.policy = UI_EVT_POLICY_COALESCE,
+	},
+	[UI_EVT_BATTERY] = {
+		.slots = &ui_evt_pool[UI_EVT_SLOT_BATTERY],
+		.depth = 1,
+		.policy = UI_EVT_POLICY_COALESCE,
+	},
+	[UI_EVT_LINK] = {
+		.slots = &ui_evt_pool[UI_EVT_SLOT_LINK],
+		.depth = 1,
+		.policy = UI_EVT_POLICY_COALESCE,
+	},
+	[UI_EVT_REC_MARK] = {
+		.slots = &ui_evt_pool[UI_EVT_SLOT_MARK],
+		.depth = UI_EVT_MARK_DEPTH,
+		.policy = UI_EVT_POLICY_DROP_OLDEST,
+	},
+};
+
+/* Posting is a few stores under a spinlock, so sources may post from ISRs. */
+static struct k_spinlock ui_evt_lock;
+static uint32_t ui_evt_seq;
+static struct k_sem *ui_evt_notify;
+
+void ui_event_set_notify(struct k_sem *sem)
+{
+	ui_evt_notify = sem;
+}
+
+int ui_event_post(struct ui_event *evt)
+{
+	struct ui_event_class *c;
+	struct k_sem *sem = ui_evt_notify;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (!evt || (uint32_t)evt->type >= UI_EVT_TYPE_COUNT) {
+		return -EINVAL;
+	}
+	c = &ui_evt_class[evt->type];
+
+	key = k_spin_lock(&ui_evt_lock);
+	evt->seq = ui_evt_seq++;
+	evt->ts_cyc = k_cycle_get_32();
+	c->stats.posted++;
+
+	if (c->count < c->depth) {
+		c->slots[(c->head + c->count) % c->depth] = *evt;
+		c->count++;
+	} else {
+		switch (c->policy) {
+		case UI_EVT_POLICY_COALESCE:
+			/* Single slot: the newest state wins, at the new position. */
+			c->slots[c->head] = *evt;
+			c->stats.coalesced++;
+			break;
+		case UI_EVT_POLICY_DROP_OLDEST:
+			c->slots[c->head] = *evt;
+			c->head = (uint8_t)((c->head + 1U) % c->depth);
+			c->stats.dropped++;
+			break;
+		default:
+			c->stats.dropped++;
+			ret = -ENOBUFS;
+			break;
+		}
+	}
+	k_spin_unlock(&ui_evt_lock, key);
+
+	if (ret == 0 && sem) {
+		k_sem_give(sem);
+	}
+	return ret;
+}
+
+int ui_event_get(struct ui_event *evt)
+{
+	struct ui_event_class *best = NULL;
+	k_spinlock_key_t key;
+	uint32_t wait_us;
+
+	if (!evt) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&ui_evt_lock);
+	for (int i = 0; i < UI_EVT_TYPE_COUNT; i++) {
+		struct ui_event_class *c = &ui_evt_class[i];
+
+		if (c->count == 0U) {
+			continue;
+		}
+		if (!best || (int32_t)(c->slots[c->head].seq - best->slots[best->head].seq) < 0) {
+			best = c;
+		}
+	}
+
+	if (!best) {
+		k_spin_unlock(&ui_evt_lock, key);
+		return -EAGAIN;
+	}
+
+	*evt = best->slots[best->head];
+	best->head = (uint8_t)((best->head + 1U) % best->depth);
+	best->count--;
+	wait_us = k_cyc_to_us_floor32(k_cycle_get_32() - evt->ts_cyc);
+	best->stats.max_wait_us = MAX(best->stats.max_wait_us, wait_us);
+	k_spin_unlock(&ui_evt_lock, key);
+
+	return 0;
+}
+
+void ui_event_get_stats(enum ui_event_type type, struct ui_event_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	if ((uint32_t)type >= UI_EVT_TYPE_COUNT || !stats) {
+		return;
+	}
+
+	key = k_spin_lock(&ui_evt_lock);
+	*stats = ui_evt_class[type].stats;
+	k_spin_unlock(&ui_evt_lock, key);
+}
@@ -0,0 +1,119 @@
+#ifndef APP_UI_EVENT_H
+#define APP_UI_EVENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#include "button.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Typed UI event bus. Input sources (button gestures, mute switch, battery,
+ * link state, recording markers) post events from any context, including
+ * ISRs; the UI thread is woken through the notify semaphore and takes them
+ * in posting order with ui_event_get().
+ *
+ * Each event class has its own slots and back-pressure policy, so a burst
+ * of one class never pushes out another:
+ *
+ *   button    queued, CONFIG_RESPEAKER_UI_EVENT_BUTTON_DEPTH deep; a full
+ *             queue rejects the new press (ui_event_post() returns -ENOBUFS)
+ *   mute      state: one slot, a newer value replaces the pending one
+ *   battery   state: as mute
+ *   link      state: as mute
+ *   rec_mark  queued, 4 deep; a full queue drops the oldest marker
+ */
+enum ui_event_type {
+	UI_EVT_BUTTON,
+	UI_EVT_MUTE,
+	UI_EVT_BATTERY,
+	UI_EVT_LINK,
+	UI_EVT_REC_MARK,
+	UI_EVT_TYPE_COUNT,
+};
+
+struct ui_event {
+	enum ui_event_type type;
+	uint32_t seq;    /* bus order, assigned by ui_event_post() */
+	uint32_t ts_cyc; /* k_cycle_get_32() when posted */
+	union {
+		button_event_t button;
+		bool muted;
+		struct {
+			uint8_t pct;
+			bool charging;
+		} battery;
+		uint8_t link; /* 0 disconnected, 1 connected, 2 BT TX, 3 WiFi TX */
+		uint16_t mark;
+	};
+};
+
+struct ui_event_stats {
+	uint32_t posted;
+	uint32_t dropped;   /* lost to a full queue */
+	uint32_t coalesced; /* state updates replaced before the UI read them */
+	uint32_t max_wait_us; /* longest post -> ui_event_get() delay */
+};
+
+/* Give sem after each accepted event; NULL disables the notification. */
+void ui_event_set_notify(struct k_sem *sem);
+
+/*
+ * Post evt (type and payload; seq and ts_cyc are filled in). Returns 0,
+ * or -ENOBUFS if the class policy rejected it, -EINVAL for a bad type.
+ */
+int ui_event_post(struct ui_event *evt);
+
+/* Take the oldest pending event. Returns 0, or -EAGAIN if none is pending. */
+int ui_event_get(struct ui_event *evt);
+
+void ui_event_get_stats(enum ui_event_type type, struct ui_event_stats *stats);
+
+static inline int ui_event_post_button(button_event_t button)
+{
+	struct ui_event evt = { .type = UI_EVT_BUTTON, .button = button };
+
+	return ui_event_post(&evt);
+}
+
+static inline int ui_event_post_mute(bool muted)
+{
+	struct ui_event evt = { .type = UI_EVT_MUTE, .muted = muted };
+
+	return ui_event_post(&evt);
+}
+
+static inline int ui_event_post_battery(uint8_t pct, bool charging)
+{
+	struct ui_event evt = {
+		.type = UI_EVT_BATTERY,
+		.battery = { .pct = pct, .charging = charging },
+	};
+
+	return ui_event_post(&evt);
+}
+
+static inline int ui_event_post_link(uint8_t link)
+{
+	struct ui_event evt = { .type = UI_EVT_LINK, .link = link };
+
+	return ui_event_post(&evt);
+}
+
+static inline int ui_event_post_rec_mark(uint16_t mark)
+{
+	struct ui_event evt = { .type = UI_EVT_REC_MARK, .mark = mark };
+
+	return ui_event_post(&evt);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_UI_EVENT_H */
@@ -0,0 +1,208 @@
+#include "ui_prof.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <string.h>
+
+#ifdef CONFIG_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
+#include "display/ch1115.h"
+#include "frame_hist.h"
+
+static const char *const ui_prof_names[UI_PROF_PHASE_COUNT] = {
+	[UI_PROF_TIMERS] = "prof timers",
+	[UI_PROF_LAYOUT] = "prof layout",
+	[UI_PROF_DRAW] = "prof draw",
+	[UI_PROF_CONVERT] = "prof convert",
+	[UI_PROF_WAIT] = "prof wait",
+	[UI_PROF_I2C] = "prof i2c",
+	[UI_PROF_FRAME] = "prof frame",
+};
+
+/* Histograms are shared with the shell thread; the rest is LVGL-thread only. */
+static struct k_spinlock prof_lock;
+static struct frame_hist prof_hist[UI_PROF_PHASE_COUNT];
+
+static struct {
+	const struct device *display_dev;
+	uint32_t t_refr;
+	uint32_t t_render;
+	uint32_t t_flush;
+	uint32_t t_wait;
+	uint32_t layout_cyc;
+	uint32_t draw_cyc;
+	uint32_t flush_cyc;
+	uint32_t wait_cyc;
+	uint32_t render_excl_cyc; /* flush + wait cycles at RENDER_START */
+	uint32_t refr_cyc;        /* refresh cycles inside the running lv_timer_handler() */
+	uint32_t bus_cycles;
+	uint32_t last_dump_ms;
+	bool rendered;
+} prof;
+
+static void ui_prof_frame_done(uint32_t frame_cyc)
+{
+	uint32_t bus = 0U;
+	k_spinlock_key_t key;
+
+	if (prof.display_dev) {
+		uint32_t now = ch1115_get_bus_cycles(prof.display_dev);
+
+		bus = now - prof.bus_cycles;
+		prof.bus_cycles = now;
+	}
+
+	key = k_spin_lock(&prof_lock);
+	frame_hist_add(&prof_hist[UI_PROF_LAYOUT], k_cyc_to_us_floor32(prof.layout_cyc));
+	frame_hist_add(&prof_hist[UI_PROF_DRAW], k_cyc_to_us_floor32(prof.draw_cyc));
+	frame_hist_add(&prof_hist[UI_PROF_CONVERT], k_cyc_to_us_floor32(prof.flush_cyc));
+	frame_hist_add(&prof_hist[UI_PROF_WAIT], k_cyc_to_us_floor32(prof.wait_cyc));
+	frame_hist_add(&prof_hist[UI_PROF_I2C], k_cyc_to_us_floor32(bus));
+	frame_hist_add(&prof_hist[UI_PROF_FRAME], k_cyc_to_us_floor32(frame_cyc));
+	k_spin_unlock(&prof_lock, key);
+}
+
+static void ui_prof_display_cb(lv_event_t *e)
+{
+	uint32_t now = k_cycle_get_32();
+
+	switch (lv_event_get_code(e)) {
+	case LV_EVENT_REFR_START:
+		prof.t_refr = now;
+		prof.flush_cyc = 0U;
+		prof.wait_cyc = 0U;
+		prof.rendered = false;
+		break;
+	case LV_EVENT_RENDER_START:
+		prof.layout_cyc = now - prof.t_refr;
+		prof.t_render = now;
+		prof.render_excl_cyc = prof.flush_cyc + prof.wait_cyc;
+		prof.rendered = true;
+		break;
+	case LV_EVENT_RENDER_READY:
+		/* Partial mode flushes (and may wait) between chunks: not drawing. */
+		prof.draw_cyc = (now - prof.t_render) -
+				((prof.flush_cyc + prof.wait_cyc) - prof.render_excl_cyc);
+		break;
+	case LV_EVENT_FLUSH_START:
+		prof.t_flush = now;
+		break;
+	case LV_EVENT_FLUSH_FINISH:
+		prof.flush_cyc += now - prof.t_flush;
+		break;
+	case LV_EVENT_FLUSH_WAIT_START:
+		prof.t_wait = now;
+		break;
+	case LV_EVENT_FLUSH_WAIT_FINISH:
+		prof.wait_cyc += now - prof.t_wait;
+		break;
+	case LV_EVENT_REFR_READY:
+		prof.refr_cyc += now - prof.t_refr;
+		/* Refreshes with nothing invalidated only run layout: not a frame. */
+		if (prof.rendered) {
+			ui_prof_frame_done(now - prof.t_refr);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+void ui_prof_init(lv_display_t *disp, const struct device *display_dev)
+{
+	prof.display_dev = display_dev;
+	if (display_dev) {
+		prof.bus_cycles = ch1115_get_bus_cycles(display_dev);
+	}
+	prof.last_dump_ms = k_uptime_get_32();
+	ui_prof_reset();
+
+	if (disp) {
+		lv_display_add_event_cb(disp, ui_prof_display_cb, LV_EVENT_ALL, NULL);
+	}
+}
+
+uint32_t ui_prof_timer_handler(void)
+{
+	uint32_t t0 = k_cycle_get_32();
+	uint32_t idle_ms;
+	uint32_t timers_cyc;
+	k_spinlock_key_t key;
+
+	prof.refr_cyc = 0U;
+	idle_ms = lv_timer_handler();
+	timers_cyc = (k_cycle_get_32() - t0) - prof.refr_cyc;
+
+	key = k_spin_lock(&prof_lock);
+	frame_hist_add(&prof_hist[UI_PROF_TIMERS], k_cyc_to_us_floor32(timers_cyc));
+	k_spin_unlock(&prof_lock, key);
+
+#if CONFIG_RESPEAKER_UI_PROF_DUMP_INTERVAL_S > 0
+	/* Piggybacks on LVGL wakeups: a static scene dumps on its next event. */
+	uint32_t now_ms = k_uptime_get_32();
+
+	if (now_ms - prof.last_dump_ms >= CONFIG_RESPEAKER_UI_PROF_DUMP_INTERVAL_S * 1000U) {
+		prof.last_dump_ms = now_ms;
+		ui_prof_dump();
+		ui_prof_reset();
+	}
+#endif
+
+	return idle_ms;
+}
+
+void ui_prof_dump(void)
+{
+	static struct frame_hist snap[UI_PROF_PHASE_COUNT];
+	k_spinlock_key_t key;
+
+	/* Copy first so printk never runs with the lock held. */
+	key = k_spin_lock(&prof_lock);
+	memcpy(snap, prof_hist, sizeof(snap));
+	k_spin_unlock(&prof_lock, key);
+
+	for (int i = 0; i < UI_PROF_PHASE_COUNT; i++) {
+		frame_hist_print(&snap[i], ui_prof_names[i]);
+	}
+}
+
+void ui_prof_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&prof_lock);
+
+	for (int i = 0; i < UI_PROF_PHASE_COUNT; i++) {
+		frame_hist_reset(&prof_hist[i]);
+	}
+	k_spin_unlock(&prof_lock, key);
+}
+
+#ifdef CONFIG_SHELL
+static int cmd_ui_prof_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	ui_prof_dump();
+	return 0;
+}
+
+static int cmd_ui_prof_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	ui_prof_reset();
+	shell_print(sh, "ui_prof: cleared");
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(ui_prof_cmds,
+	SHELL_CMD(dump, NULL, "Print per-phase frame time histograms", cmd_ui_prof_dump),
+	SHELL_CMD(reset, NULL, "Clear the histograms", cmd_ui_prof_reset),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(ui_prof, &ui_prof_cmds, "LVGL render-phase profiler", NULL);
+#endif /* CONFIG_SHELL */
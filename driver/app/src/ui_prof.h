@@ -0,0 +1,81 @@
+#ifndef APP_UI_PROF_H
+#define APP_UI_PROF_H
+
+#include <stdint.h>
+
+#include <zephyr/device.h>
+#include <zephyr/sys/util.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Render-phase profiler (CONFIG_RESPEAKER_UI_PROF). Timestamps LVGL display
+ * events with the cycle counter and keeps one frame_hist per phase of a
+ * rendered frame:
+ *
+ *   timers   lv_timer_handler() time outside the display refresh
+ *   layout   LV_EVENT_REFR_START -> RENDER_START (layout and style refresh)
+ *   draw     RENDER_START -> RENDER_READY, minus convert and wait
+ *   convert  FLUSH_START -> FLUSH_FINISH summed per frame: Zephyr's flush_cb,
+ *            i.e. the I1 -> VTILED conversion and the hand-off to the driver
+ *   wait     FLUSH_WAIT_START -> FLUSH_WAIT_FINISH summed per frame
+ *   i2c      OLED GDDRAM transfer time since the previous frame; in paced
+ *            mode (FRAME_INTERVAL_MS > 0) the driver's work queue sends a
+ *            frame one interval later, so its time lands on a later frame
+ *   frame    REFR_START -> REFR_READY
+ *
+ * With the option off every call below is an empty inline, so the app pays
+ * nothing for the hooks.
+ */
+enum ui_prof_phase {
+	UI_PROF_TIMERS,
+	UI_PROF_LAYOUT,
+	UI_PROF_DRAW,
+	UI_PROF_CONVERT,
+	UI_PROF_WAIT,
+	UI_PROF_I2C,
+	UI_PROF_FRAME,
+	UI_PROF_PHASE_COUNT,
+};
+
+#ifdef CONFIG_RESPEAKER_UI_PROF
+/* Hook the display events; display_dev is the CH1115 (for the I2C phase). */
+void ui_prof_init(lv_display_t *disp, const struct device *display_dev);
+
+/* lv_timer_handler() with the timers phase measured around it. */
+uint32_t ui_prof_timer_handler(void);
+
+/* Print every phase histogram via printk. */
+void ui_prof_dump(void);
+
+/* Clear the histograms before the next frame. Safe from any thread. */
+void ui_prof_reset(void);
+#else
+static inline void ui_prof_init(lv_display_t *disp, const struct device *display_dev)
+{
+	ARG_UNUSED(disp);
+	ARG_UNUSED(display_dev);
+}
+
+static inline uint32_t ui_prof_timer_handler(void)
+{
+	return lv_timer_handler();
+}
+
+static inline void ui_prof_dump(void)
+{
+}
+
+static inline void ui_prof_reset(void)
+{
+}
+#endif /* CONFIG_RESPEAKER_UI_PROF */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_UI_PROF_H */
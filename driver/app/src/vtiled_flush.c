@@ -0,0 +1,118 @@
+#include "vtiled_flush.h"
+
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <errno.h>
+
+#include "display/mono_bitops.h"
+
+LOG_MODULE_REGISTER(vtiled_flush, LOG_LEVEL_INF);
+
+/* LVGL prepends the 2-entry I1 palette to every rendered area. */
+#define VTILED_FLUSH_PALETTE_SIZE 8U
+
+#ifdef CONFIG_LV_Z_FLUSH_THREAD
+/*
+ * Takes over from the glue's flush thread, whose queue is fed only by the
+ * stock flush callback. LVGL waits for a flush before it calls flush_cb on
+ * that display again, so each display has at most one area in flight.
+ */
+K_MSGQ_DEFINE(vtiled_flush_queue, sizeof(struct vtiled_flush *), 1, 4);
+
+static void vtiled_flush_thread_entry(void *p1, void *p2, void *p3)
+{
+	struct vtiled_flush *vf;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_msgq_get(&vtiled_flush_queue, &vf, K_FOREVER);
+		(void)display_write(vf->dev, vf->x, vf->y, &vf->desc, vf->buf);
+		k_sem_give(&vf->done);
+	}
+}
+
+K_THREAD_DEFINE(vtiled_flush_thread, CONFIG_LV_Z_FLUSH_THREAD_STACK_SIZE,
+		vtiled_flush_thread_entry, NULL, NULL, NULL,
+		K_PRIO_COOP(CONFIG_LV_Z_FLUSH_THREAD_PRIORITY), 0, 0);
+
+/*
+ * flush_ready is only signalled here, not from the worker, so LVGL's
+ * flushing flag stays set until this wait has consumed the write.
+ */
+static void vtiled_flush_wait_cb(lv_display_t *disp)
+{
+	struct vtiled_flush *vf = lv_display_get_driver_data(disp);
+
+	k_sem_take(&vf->done, K_FOREVER);
+	lv_display_flush_ready(disp);
+}
+#endif /* CONFIG_LV_Z_FLUSH_THREAD */
+
+static void vtiled_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+	struct vtiled_flush *vf = lv_display_get_driver_data(disp);
+	uint32_t w = (uint32_t)lv_area_get_width(area);
+	uint32_t h = (uint32_t)lv_area_get_height(area);
+	struct display_buffer_descriptor desc = {
+		.buf_size = w * (h / 8U),
+		.width = (uint16_t)w,
+		.height = (uint16_t)h,
+		.pitch = (uint16_t)w,
+	};
+
+	/* The VTILED rounder keeps areas page aligned; anything else is a bug. */
+	if (((area->y1 | h) & 7U) != 0U || desc.buf_size > vf->buf_size) {
+		LOG_ERR("Unsupported flush area %dx%d at y=%d", (int)w, (int)h, (int)area->y1);
+		lv_display_flush_ready(disp);
+		return;
+	}
+
+	mono_i1_to_vtiled(vf->buf, px_map + VTILED_FLUSH_PALETTE_SIZE, w, h,
+			  lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_I1), vf->invert);
+#ifdef CONFIG_LV_Z_FLUSH_THREAD
+	/* px_map is free again; LVGL renders into it while the worker writes. */
+	vf->x = (uint16_t)area->x1;
+	vf->y = (uint16_t)area->y1;
+	vf->desc = desc;
+	(void)k_msgq_put(&vtiled_flush_queue, &vf, K_FOREVER);
+#else
+	(void)display_write(vf->dev, (uint16_t)area->x1, (uint16_t)area->y1, &desc, vf->buf);
+	lv_display_flush_ready(disp);
+#endif
+}
+
+int vtiled_flush_install(lv_display_t *disp, struct vtiled_flush *vf,
+			 const struct device *dev, uint8_t *buf, size_t buf_size)
+{
+	struct display_capabilities caps;
+
+	if (!disp || !vf || !dev || !buf) {
+		return -EINVAL;
+	}
+
+	display_get_capabilities(dev, &caps);
+	if ((caps.screen_info & SCREEN_INFO_MONO_VTILED) == 0U ||
+	    (caps.screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0U) {
+		return -ENOTSUP;
+	}
+
+	vf->dev = dev;
+	vf->buf = buf;
+	vf->buf_size = buf_size;
+	vf->invert = (caps.current_pixel_format == PIXEL_FORMAT_MONO10);
+
+	lv_display_set_driver_data(disp, vf);
+	lv_display_set_flush_cb(disp, vtiled_flush_cb);
+	/* The glue's wait callback waits on its own flush thread, never fed now. */
+#ifdef CONFIG_LV_Z_FLUSH_THREAD
+	k_sem_init(&vf->done, 0, 1);
+	lv_display_set_flush_wait_cb(disp, vtiled_flush_wait_cb);
+#else
+	lv_display_set_flush_wait_cb(disp, NULL);
+#endif
+	return 0;
+}
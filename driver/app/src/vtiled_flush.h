@@ -0,0 +1,55 @@
+#ifndef APP_VTILED_FLUSH_H
+#define APP_VTILED_FLUSH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Fast LVGL flush for VTILED mono panels (CONFIG_RESPEAKER_UI_VTILED_FLUSH).
+ * Replaces the Zephyr glue's per-pixel I1 -> VTILED conversion on one
+ * lv_display with mono_i1_to_vtiled() (8x8 bit-matrix transposes) followed
+ * by display_write(). Opt in per display by calling vtiled_flush_install().
+ *
+ * With LV_Z_FLUSH_THREAD the converted area is written by a worker thread
+ * and the display's flush wait callback blocks until that write is done,
+ * so LVGL renders the next area (LV_Z_DOUBLE_VDB) during the I2C transfer
+ * and LV_EVENT_FLUSH_WAIT_FINISH still marks the end of the transfer.
+ * Without it, display_write() runs inside flush_cb.
+ */
+struct vtiled_flush {
+	const struct device *dev;
+	uint8_t *buf;
+	size_t buf_size;
+	bool invert;
+#ifdef CONFIG_LV_Z_FLUSH_THREAD
+	/* Area handed to the worker */
+	uint16_t x;
+	uint16_t y;
+	struct display_buffer_descriptor desc;
+	struct k_sem done;
+#endif
+};
+
+/*
+ * Take over disp's flush and flush wait callbacks. buf receives the converted area and must
+ * hold the largest flushed area (width * height / 8 bytes). Set the panel's
+ * pixel format first: PIXEL_FORMAT_MONO10 inverts, as in the stock path.
+ */
+int vtiled_flush_install(lv_display_t *disp, struct vtiled_flush *vf,
+			 const struct device *dev, uint8_t *buf, size_t buf_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_VTILED_FLUSH_H */
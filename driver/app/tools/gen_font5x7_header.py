@@ -0,0 +1,243 @@
+"""Generate the simple_ui 5x7 font header (only the glyphs the UI draws).
+
+The full printable-ASCII 5x7 font lives in this script. The header gets a
+blank glyph plus every character found in the text passed to draw_string()
+in the scanned sources and in --chars, so the firmware carries a few dozen
+bytes of font instead of ~500, while lookup stays a single table index.
+
+The app build runs this script (see CMakeLists.txt) with --scan
+simple_ui_render.c and --chars from CONFIG_RESPEAKER_SIMPLE_UI_FONT_CHARS,
+so a new title string pulls its glyphs in on the next build. Characters of
+text built at run time (timestamps) cannot be found by the scan and must be
+in --chars.
+
+Usage (PowerShell):
+        python ./tools/gen_font5x7_header.py --scan ./simple_ui_render.c --chars "0123456789:" ./font5x7.h
+        python ./tools/gen_font5x7_header.py --all ./font5x7.h
+
+Scan rule: the second argument of each draw_string() call, if it is a string
+literal or a macro #define'd to one in the same file. Other arguments are
+reported and skipped.
+
+Conventions:
+- Layout: page columns, FONT5X7_W bytes per glyph, bit j = row j (bit 0 =
+    top), i.e. the CH1115 GDDRAM / SCREEN_INFO_MONO_VTILED byte layout.
+- 1 = lit pixel.
+- font5x7_index[c - FONT5X7_FIRST] is the glyph slot of c; slot 0 is blank
+    and stands in for space and for every character that was not generated,
+    including those outside FONT5X7_FIRST..FONT5X7_LAST.
+"""
+
+from __future__ import annotations
+
+import re
+import sys
+from pathlib import Path
+
+GLYPH_W = 5
+GLYPH_H = 7
+
+# Classic 5x7 ASCII font, 0x20..0x7E, one byte per column, bit 0 = top row.
+FONT: dict[str, tuple[int, int, int, int, int]] = {
+    " ": (0x00, 0x00, 0x00, 0x00, 0x00),
+    "!": (0x00, 0x00, 0x5F, 0x00, 0x00),
+    '"': (0x00, 0x07, 0x00, 0x07, 0x00),
+    "#": (0x14, 0x7F, 0x14, 0x7F, 0x14),
+    "$": (0x24, 0x2A, 0x7F, 0x2A, 0x12),
+    "%": (0x23, 0x13, 0x08, 0x64, 0x62),
+    "&": (0x36, 0x49, 0x55, 0x22, 0x50),
+    "'": (0x00, 0x05, 0x03, 0x00, 0x00),
+    "(": (0x00, 0x1C, 0x22, 0x41, 0x00),
+    ")": (0x00, 0x41, 0x22, 0x1C, 0x00),
+    "*": (0x08, 0x2A, 0x1C, 0x2A, 0x08),
+    "+": (0x08, 0x08, 0x3E, 0x08, 0x08),
+    ",": (0x00, 0x50, 0x30, 0x00, 0x00),
+    "-": (0x08, 0x08, 0x08, 0x08, 0x08),
+    ".": (0x00, 0x60, 0x60, 0x00, 0x00),
+    "/": (0x20, 0x10, 0x08, 0x04, 0x02),
+    "0": (0x3E, 0x51, 0x49, 0x45, 0x3E),
+    "1": (0x00, 0x42, 0x7F, 0x40, 0x00),
+    "2": (0x42, 0x61, 0x51, 0x49, 0x46),
+    "3": (0x21, 0x41, 0x45, 0x4B, 0x31),
+    "4": (0x18, 0x14, 0x12, 0x7F, 0x10),
+    "5": (0x27, 0x45, 0x45, 0x45, 0x39),
+    "6": (0x3C, 0x4A, 0x49, 0x49, 0x30),
+    "7": (0x01, 0x71, 0x09, 0x05, 0x03),
+    "8": (0x36, 0x49, 0x49, 0x49, 0x36),
+    "9": (0x06, 0x49, 0x49, 0x29, 0x1E),
+    ":": (0x00, 0x36, 0x36, 0x00, 0x00),
+    ";": (0x00, 0x56, 0x36, 0x00, 0x00),
+    "<": (0x08, 0x14, 0x22, 0x41, 0x00),
+    "=": (0x14, 0x14, 0x14, 0x14, 0x14),
+    ">": (0x00, 0x41, 0x22, 0x14, 0x08),
+    "?": (0x02, 0x01, 0x51, 0x09, 0x06),
+    "@": (0x32, 0x49, 0x79, 0x41, 0x3E),
+    "A": (0x7E, 0x11, 0x11, 0x11, 0x7E),
+    "B": (0x7F, 0x49, 0x49, 0x49, 0x36),
+    "C": (0x3E, 0x41, 0x41, 0x41, 0x22),
+    "D": (0x7F, 0x41, 0x41, 0x22, 0x1C),
+    "E": (0x7F, 0x49, 0x49, 0x49, 0x41),
+    "F": (0x7F, 0x09, 0x09, 0x09, 0x01),
+    "G": (0x3E, 0x41, 0x49, 0x49, 0x7A),
+    "H": (0x7F, 0x08, 0x08, 0x08, 0x7F),
+    "I": (0x00, 0x41, 0x7F, 0x41, 0x00),
+    "J": (0x20, 0x40, 0x41, 0x3F, 0x01),
+    "K": (0x7F, 0x08, 0x14, 0x22, 0x41),
+    "L": (0x7F, 0x40, 0x40, 0x40, 0x40),
+    "M": (0x7F, 0x02, 0x0C, 0x02, 0x7F),
+    "N": (0x7F, 0x04, 0x08, 0x10, 0x7F),
+    "O": (0x3E, 0x41, 0x41, 0x41, 0x3E),
+    "P": (0x7F, 0x09, 0x09, 0x09, 0x06),
+    "Q": (0x3E, 0x41, 0x51, 0x21, 0x5E),
+    "R": (0x7F, 0x09, 0x19, 0x29, 0x46),
+    "S": (0x46, 0x49, 0x49, 0x49, 0x31),
+    "T": (0x01, 0x01, 0x7F, 0x01, 0x01),
+    "U": (0x3F, 0x40, 0x40, 0x40, 0x3F),
+    "V": (0x1F, 0x20, 0x40, 0x20, 0x1F),
+    "W": (0x3F, 0x40, 0x38, 0x40, 0x3F),
+    "X": (0x63, 0x14, 0x08, 0x14, 0x63),
+    "Y": (0x07, 0x08, 0x70, 0x08, 0x07),
+    "Z": (0x61, 0x51, 0x49, 0x45, 0x43),
+    "[": (0x00, 0x7F, 0x41, 0x41, 0x00),
+    "\\": (0x02, 0x04, 0x08, 0x10, 0x20),
+    "]": (0x00, 0x41, 0x41, 0x7F, 0x00),
+    "^": (0x04, 0x02, 0x01, 0x02, 0x04),
+    "_": (0x40, 0x40, 0x40, 0x40, 0x40),
+    "`": (0x00, 0x01, 0x02, 0x04, 0x00),
+    "a": (0x20, 0x54, 0x54, 0x54, 0x78),
+    "b": (0x7F, 0x48, 0x44, 0x44, 0x38),
+    "c": (0x38, 0x44, 0x44, 0x44, 0x20),
+    "d": (0x38, 0x44, 0x44, 0x48, 0x7F),
+    "e": (0x38, 0x54, 0x54, 0x54, 0x18),
+    "f": (0x08, 0x7E, 0x09, 0x01, 0x02),
+    "g": (0x0C, 0x52, 0x52, 0x52, 0x3E),
+    "h": (0x7F, 0x08, 0x04, 0x04, 0x78),
+    "i": (0x00, 0x44, 0x7D, 0x40, 0x00),
+    "j": (0x20, 0x40, 0x44, 0x3D, 0x00),
+    "k": (0x7F, 0x10, 0x28, 0x44, 0x00),
+    "l": (0x00, 0x41, 0x7F, 0x40, 0x00),
+    "m": (0x7C, 0x04, 0x18, 0x04, 0x78),
+    "n": (0x7C, 0x08, 0x04, 0x04, 0x78),
+    "o": (0x38, 0x44, 0x44, 0x44, 0x38),
+    "p": (0x7C, 0x14, 0x14, 0x14, 0x08),
+    "q": (0x08, 0x14, 0x14, 0x18, 0x7C),
+    "r": (0x7C, 0x08, 0x04, 0x04, 0x08),
+    "s": (0x48, 0x54, 0x54, 0x54, 0x20),
+    "t": (0x04, 0x3F, 0x44, 0x40, 0x20),
+    "u": (0x3C, 0x40, 0x40, 0x20, 0x7C),
+    "v": (0x1C, 0x20, 0x40, 0x20, 0x1C),
+    "w": (0x3C, 0x40, 0x30, 0x40, 0x3C),
+    "x": (0x44, 0x28, 0x10, 0x28, 0x44),
+    "y": (0x0C, 0x50, 0x50, 0x50, 0x3C),
+    "z": (0x44, 0x64, 0x54, 0x4C, 0x44),
+    "{": (0x00, 0x08, 0x36, 0x41, 0x00),
+    "|": (0x00, 0x00, 0x7F, 0x00, 0x00),
+    "}": (0x00, 0x41, 0x36, 0x08, 0x00),
+    "~": (0x08, 0x04, 0x08, 0x10, 0x08),
+}
+
+DRAW_STRING_RE = re.compile(r'\bdraw_string\s*\(\s*[^,()]+,\s*("(?:[^"\\]|\\.)*"|[\w.\->\[\]]+)\s*,')
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+DEFINE_RE = re.compile(r'^\s*#\s*define\s+(\w+)\s+"((?:[^"\\]|\\.)*)"', re.MULTILINE)
+
+
+def unescape(s: str) -> str:
+    return s.encode("utf-8").decode("unicode_escape")
+
+
+def scan_source(path: Path) -> str:
+    text = path.read_text(encoding="utf-8")
+    defines = {name: unescape(value) for name, value in DEFINE_RE.findall(text)}
+    used = []
+    for m in DRAW_STRING_RE.finditer(text):
+        arg = m.group(1)
+        lit = STRING_RE.fullmatch(arg)
+        if lit:
+            used.append(unescape(lit.group(1)))
+        elif arg in defines:
+            used.append(defines[arg])
+        else:
+            print(f"note: {path.name}: draw_string({arg}) is not a literal; "
+                  f"add its characters with --chars")
+    return "".join(used)
+
+
+def write_header(out_path: Path, chars: str) -> int:
+    missing = sorted({c for c in chars if c not in FONT})
+    if missing:
+        raise SystemExit(f"No glyph for: {''.join(missing)!r}")
+
+    # Slot 0 is the blank glyph: space and every character not generated.
+    glyph_chars = sorted({c for c in chars if c != " "})
+    first = min((ord(c) for c in glyph_chars), default=ord(" "))
+    last = max((ord(c) for c in glyph_chars), default=ord(" "))
+    slot = {c: i + 1 for i, c in enumerate(glyph_chars)}
+    glyphs = [FONT[" "]] + [FONT[c] for c in glyph_chars]
+
+    lines: list[str] = []
+    lines.append("#pragma once\n\n")
+    lines.append("/* Generated by tools/gen_font5x7_header.py - do not edit. */\n\n")
+    lines.append("#include <stdint.h>\n\n")
+    lines.append("/*\n")
+    lines.append(f" * 5x7 font, {len(glyph_chars)} glyphs + blank: "
+                 f"{''.join(glyph_chars).replace('*/', '* /')}\n")
+    lines.append(" * - Layout: page columns, FONT5X7_W bytes per glyph, bit j = row j\n")
+    lines.append(" * - Value:  1 = lit pixel\n")
+    lines.append(" * - Index:  font5x7_index[c - FONT5X7_FIRST] = glyph slot, 0 = blank;\n"
+                 " *           characters outside FIRST..LAST are blank too\n")
+    lines.append(" */\n\n")
+    lines.append(f"#define FONT5X7_W {GLYPH_W}\n")
+    lines.append(f"#define FONT5X7_H {GLYPH_H}\n")
+    lines.append(f"#define FONT5X7_FIRST 0x{first:02X}\n")
+    lines.append(f"#define FONT5X7_LAST 0x{last:02X}\n")
+    lines.append(f"#define FONT5X7_GLYPHS {len(glyphs)}\n\n")
+
+    index = [slot.get(chr(c), 0) for c in range(first, last + 1)]
+    lines.append("static const uint8_t font5x7_index[FONT5X7_LAST - FONT5X7_FIRST + 1] = {\n")
+    for j in range(0, len(index), 16):
+        lines.append("\t" + ", ".join(f"{v}" for v in index[j : j + 16]) + ",\n")
+    lines.append("};\n\n")
+
+    lines.append("static const uint8_t font5x7_glyphs[FONT5X7_GLYPHS * FONT5X7_W] = {\n")
+    for c, g in zip([" "] + glyph_chars, glyphs):
+        name = "blank" if c == " " else repr(c).replace("*/", "* /")
+        lines.append("\t" + ", ".join(f"0x{b:02X}" for b in g) + f", /* {name} */\n")
+    lines.append("};\n")
+
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    out_path.write_text("".join(lines), encoding="utf-8", newline="\n")
+    return len(index) + len(glyphs) * GLYPH_W
+
+
+def main(argv: list[str]) -> int:
+    args = argv[1:]
+    chars = ""
+    scans: list[Path] = []
+    out: list[str] = []
+
+    while args:
+        a = args.pop(0)
+        if a == "--all":
+            chars += "".join(FONT)
+        elif a == "--chars" and args:
+            chars += unescape(args.pop(0))
+        elif a == "--scan" and args:
+            scans.append(Path(args.pop(0)))
+        else:
+            out.append(a)
+
+    if len(out) != 1:
+        print("Usage: gen_font5x7_header.py [--all] [--chars <text>] [--scan <file.c>]... <out.h>")
+        return 2
+
+    for path in scans:
+        chars += scan_source(path)
+
+    out_path = Path(out[0])
+    size = write_header(out_path, chars)
+    print(f"Wrote {out_path} ({size} bytes, {len(set(chars) - {' '})} glyphs)")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv))
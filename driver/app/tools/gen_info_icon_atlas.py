@@ -0,0 +1,210 @@
+"""Generate the INFO page icon atlas header (pre-rendered 1bpp icon states).
+
+Every state of every INFO icon (battery level x charging, wireless state,
+mode, pending audio) is rasterized from the rectangle lists below into one
+20x20 tile. The firmware then shows one image per icon and switches state by
+pointing it at another tile, instead of composing each icon from several
+rectangle objects.
+
+Usage (PowerShell):
+        python ./tools/gen_info_icon_atlas.py ./src/info_icon_atlas.h
+        python ./tools/gen_info_icon_atlas.py --vtiled ./info_icon_atlas_vt.h
+
+Formats:
+- default (LVGL): one LV_COLOR_FORMAT_I1 image per tile. Each tile is a
+    2-entry palette (black, white) followed by row-major, MSB-first rows,
+    stride = ceil(W/8) bytes. Emits lv_image_dsc_t descriptors into the atlas.
+- --vtiled: raw CH1115 GDDRAM layout (Zephyr SCREEN_INFO_MONO_VTILED). Each
+    tile is ceil(H/8) pages of W bytes; bit j of a byte is row 8*page + j.
+    A tile at a page-aligned y can be sent with display_write() as is.
+
+Conventions:
+- 1 = lit (white) pixel, 0 = black.
+- Rectangles are (x, y, w, h) in tile coordinates; later rectangles in BG
+    color clear pixels (battery charging cut-out).
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+TILE_W = 20
+TILE_H = 20
+STROKE = 2
+
+# Battery body outline: 14x11 at (3,6), inner width 10px.
+BAT_X, BAT_Y, BAT_W, BAT_H = 3, 6, 14, 11
+BAT_INNER_W = 10
+BAT_LEVELS = 6  # fill widths 0, 2, 4, 6, 8, 10 px
+
+BAT_FRAME = [
+    (7, 3, 6, 3),  # terminal
+    (BAT_X, BAT_Y, BAT_W, STROKE),
+    (BAT_X, BAT_Y, STROKE, BAT_H),
+    (BAT_X, BAT_Y + BAT_H - STROKE, BAT_W, STROKE),
+    (BAT_X + BAT_W - STROKE, BAT_Y, STROKE, BAT_H),
+]
+
+# Charging marker: chunky lightning cut-out, cleared inside the fill.
+BAT_CHARGE_CUT = [
+    (BAT_X + 6, BAT_Y + 2, 3, 3),
+    (BAT_X + 5, BAT_Y + 5, 5, 3),
+]
+
+WIRE_LINK = [(3, 8, 5, 5), (12, 8, 5, 5)]
+WIRE_CONNECTOR = [(7, 9, 6, 3)]
+
+MIC = [(6, 3, 8, 2), (7, 5, 6, 9), (9, 14, 2, 3), (6, 18, 8, 2)]
+
+
+def battery(level: int, charging: bool) -> tuple[list, list]:
+    fill_w = (BAT_INNER_W * level) // (BAT_LEVELS - 1)
+    rects = list(BAT_FRAME)
+    if fill_w > 0:
+        rects.append((BAT_X + STROKE, BAT_Y + STROKE, fill_w, BAT_H - 2 * STROKE))
+    return rects, (BAT_CHARGE_CUT if charging else [])
+
+
+def icon_states() -> list[tuple[str, list, list]]:
+    """(enum suffix, lit rects, cleared rects) in atlas order."""
+    states = []
+    for level in range(BAT_LEVELS):
+        states.append((f"BAT_L{level}", *battery(level, False)))
+    for level in range(BAT_LEVELS):
+        states.append((f"BAT_CHG_L{level}", *battery(level, True)))
+
+    # Wireless: indexed by the UI wire state (0..3).
+    states.append(("WIRE_DISCONNECTED",
+                   WIRE_LINK + [(7, 6, 3, 3), (9, 9, 3, 3), (11, 12, 3, 3)], []))
+    states.append(("WIRE_CONNECTED", WIRE_LINK + WIRE_CONNECTOR, []))
+    states.append(("WIRE_BT_TX",
+                   WIRE_LINK + WIRE_CONNECTOR + [(15, 3, 2, 5), (17, 2, 2, 7)], []))
+    states.append(("WIRE_WIFI_TX",
+                   WIRE_LINK + WIRE_CONNECTOR + [(14, 4, 2, 4), (16, 3, 2, 6), (18, 2, 2, 8)],
+                   []))
+
+    # Mode: microphone (normal) vs microphone + gain bars (enhanced).
+    states.append(("MODE_NORMAL", MIC, []))
+    states.append(("MODE_ENH", MIC + [(3, 6, 2, 8), (15, 6, 2, 8)], []))
+
+    # Pending audio: trays + upload arrow (shaft + head).
+    states.append(("PENDING", [(3, 13, 14, 3), (3, 17, 14, 3), (9, 5, 3, 9), (6, 3, 9, 3)], []))
+    return states
+
+
+def rasterize(lit: list, cleared: list) -> list[list[int]]:
+    px = [[0] * TILE_W for _ in range(TILE_H)]
+    for rects, value in ((lit, 1), (cleared, 0)):
+        for x, y, w, h in rects:
+            if x < 0 or y < 0 or x + w > TILE_W or y + h > TILE_H:
+                raise ValueError(f"Rectangle {(x, y, w, h)} outside {TILE_W}x{TILE_H} tile")
+            for yy in range(y, y + h):
+                for xx in range(x, x + w):
+                    px[yy][xx] = value
+    return px
+
+
+def pack_i1(px: list[list[int]]) -> bytes:
+    # Palette: index 0 black, index 1 white (LVGL 9 stores B, G, R, A).
+    out = bytearray([0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF])
+    for row in px:
+        for xb in range(0, TILE_W, 8):
+            byte = 0
+            for bit in range(8):
+                x = xb + bit
+                if x < TILE_W and row[x]:
+                    byte |= 1 << (7 - bit)
+            out.append(byte)
+    return bytes(out)
+
+
+def pack_vtiled(px: list[list[int]]) -> bytes:
+    out = bytearray()
+    for page in range((TILE_H + 7) // 8):
+        for x in range(TILE_W):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < TILE_H and px[y][x]:
+                    byte |= 1 << bit
+            out.append(byte)
+    return bytes(out)
+
+
+def write_header(out_path: Path, vtiled: bool) -> int:
+    states = icon_states()
+    tiles = [(pack_vtiled if vtiled else pack_i1)(rasterize(lit, cut)) for _, lit, cut in states]
+    tile_bytes = len(tiles[0])
+    atlas = b"".join(tiles)
+
+    lines: list[str] = []
+    lines.append("#pragma once\n\n")
+    lines.append("/* Generated by tools/gen_info_icon_atlas.py - do not edit. */\n\n")
+    lines.append("#include <stdint.h>\n\n")
+    if not vtiled:
+        lines.append("#include <lvgl.h>\n\n")
+    lines.append("/*\n")
+    lines.append(" * INFO page icon atlas (1bpp), one tile per icon state.\n")
+    if vtiled:
+        lines.append(" * - Layout: VTILED pages, W bytes per page, bit j = row 8*page + j\n")
+    else:
+        lines.append(" * - Layout: LV_COLOR_FORMAT_I1, 8-byte palette + row-major MSB-first rows\n")
+    lines.append(" * - Value:  1 = lit pixel\n")
+    lines.append(" */\n\n")
+    lines.append(f"#define INFO_ATLAS_TILE_W {TILE_W}\n")
+    lines.append(f"#define INFO_ATLAS_TILE_H {TILE_H}\n")
+    lines.append(f"#define INFO_ATLAS_TILE_BYTES {tile_bytes}\n")
+    lines.append(f"#define INFO_ATLAS_BAT_LEVELS {BAT_LEVELS}\n\n")
+
+    lines.append("enum info_icon {\n")
+    for name, _, _ in states:
+        lines.append(f"\tINFO_ICON_{name},\n")
+    lines.append("\tINFO_ICON_COUNT,\n")
+    lines.append("};\n\n")
+
+    lines.append("static const uint8_t info_icon_atlas[INFO_ICON_COUNT * INFO_ATLAS_TILE_BYTES] = {\n")
+    for i, (name, _, _) in enumerate(states):
+        lines.append(f"\t/* {name} */\n")
+        tile = tiles[i]
+        for j in range(0, len(tile), 12):
+            lines.append("\t" + ", ".join(f"0x{b:02X}" for b in tile[j : j + 12]) + ",\n")
+    lines.append("};\n")
+
+    if not vtiled:
+        lines.append("\n#define INFO_ICON_IMG(i) \\\n")
+        lines.append("\t{ \\\n")
+        lines.append("\t\t.header.magic = LV_IMAGE_HEADER_MAGIC, \\\n")
+        lines.append("\t\t.header.cf = LV_COLOR_FORMAT_I1, \\\n")
+        lines.append("\t\t.header.w = INFO_ATLAS_TILE_W, \\\n")
+        lines.append("\t\t.header.h = INFO_ATLAS_TILE_H, \\\n")
+        lines.append("\t\t.header.stride = (INFO_ATLAS_TILE_W + 7) / 8, \\\n")
+        lines.append("\t\t.data_size = INFO_ATLAS_TILE_BYTES, \\\n")
+        lines.append("\t\t.data = &info_icon_atlas[(i) * INFO_ATLAS_TILE_BYTES], \\\n")
+        lines.append("\t}\n\n")
+        lines.append("static const lv_image_dsc_t info_icon_img[INFO_ICON_COUNT] = {\n")
+        for name, _, _ in states:
+            lines.append(f"\tINFO_ICON_IMG(INFO_ICON_{name}),\n")
+        lines.append("};\n")
+
+    out_path.write_text("".join(lines), encoding="utf-8", newline="\n")
+    return len(atlas)
+
+
+def main(argv: list[str]) -> int:
+    args = argv[1:]
+    vtiled = "--vtiled" in args
+    args = [a for a in args if a != "--vtiled"]
+    if len(args) != 1:
+        print("Usage: gen_info_icon_atlas.py [--vtiled] <out.h>")
+        return 2
+
+    out_path = Path(args[0])
+    size = write_header(out_path, vtiled)
+    print(f"Wrote {out_path} ({size} bytes atlas, {len(icon_states())} tiles, "
+          f"{'vtiled' if vtiled else 'lvgl i1'})")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv))
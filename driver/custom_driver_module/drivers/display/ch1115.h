@@ -0,0 +1,197 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CH1115 driver-specific API (solomon,ch1115).
+ * Everything here works on top of the regular display API: coordinates are
+ * display pixels, and y/height must be multiples of 8 (one GDDRAM page).
+ *
+ * Orientation (display_set_orientation()): NORMAL and ROTATED_180 use the
+ * controller's segment remap and COM scan direction, so they cost nothing
+ * per write. ROTATED_90/270 report swapped resolution; writes are transposed
+ * in 8x8 blocks into the shadow, so x/width must also be multiples of 8.
+ * ch1115_fill() follows the current orientation and mirrors like a write.
+ * ch1115_scroll() and ch1115_set_active_rows() do too, except under
+ * ROTATED_90/270, where their axes would cross the panel's: they return
+ * -ENOTSUP there (set_active_rows() still accepts height = 0).
+ *
+ * PM suspend keeps GDDRAM. Writes, fills and scrolls issued while suspended
+ * land in the shadow and are replayed page run by page run on resume, right
+ * before display-on; nothing needs to be redrawn after a wake.
+ */
+
+enum ch1115_scroll_dir {
+	CH1115_SCROLL_LEFT = 0,
+	CH1115_SCROLL_RIGHT = 1,
+};
+
+/**
+ * Rotate the page band [y, y + height) by one column.
+ *
+ * Needs the devicetree "column-scroll" flag: the controller's content scroll
+ * moves GDDRAM in place and the call costs one 8-byte command transaction;
+ * the caller then only writes the newly exposed column. Without the flag it
+ * returns -ENOTSUP and changes nothing; callers redraw the band themselves
+ * (resending it would cost a whole band per step).
+ */
+int ch1115_scroll(const struct device *dev, enum ch1115_scroll_dir dir, uint16_t y,
+		  uint16_t height);
+
+/**
+ * Solid fill of a pixel rectangle (any y/height; partial pages are masked).
+ *
+ * The controller has no fill command, so the fill is applied to the shadow
+ * and streamed out as page runs through the driver's small static transfer
+ * buffer; no frame-sized buffer is needed. display_clear() uses this path.
+ */
+int ch1115_fill(const struct device *dev, uint16_t x, uint16_t y, uint16_t width,
+		uint16_t height, bool set);
+
+/** Write pacing counters since boot or the last ch1115_reset_stats(). */
+struct ch1115_stats {
+	uint32_t raw_writes;       /* display_write() calls accepted */
+	uint32_t coalesced_writes; /* writes merged into an already pending frame */
+	uint32_t flushes;          /* paced frames sent */
+	uint32_t bytes_sent;       /* GDDRAM bytes put on the bus */
+	uint32_t bus_cycles;       /* cycles spent in GDDRAM I2C transfers (wraps) */
+};
+
+/**
+ * Set the paced frame interval. Writes arriving within one interval are
+ * merged in the shadow buffer and sent as one transaction per dirty page
+ * run when the interval expires. 0 selects write-through (the default,
+ * see CONFIG_CUSTOM_OLED_DISPLAY_128X64_FRAME_INTERVAL_MS).
+ */
+int ch1115_set_frame_interval(const struct device *dev, uint32_t interval_ms);
+
+/** Send the pending paced frame now instead of waiting for the interval. */
+int ch1115_flush(const struct device *dev);
+
+void ch1115_get_stats(const struct device *dev, struct ch1115_stats *stats);
+
+void ch1115_reset_stats(const struct device *dev);
+
+/**
+ * Current stats.bus_cycles, read without taking the driver lock so that a
+ * per-frame profiler never waits for an I2C transfer to finish. Take the
+ * difference of two readings (the counter wraps). Transfers are only timed
+ * with CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_TIMING; otherwise this stays 0.
+ *
+ * In paced mode the transfers run from the driver's flush work one frame
+ * interval after the writes, so they show up in a later reading than the
+ * frame that drew them.
+ */
+uint32_t ch1115_get_bus_cycles(const struct device *dev);
+
+/*
+ * Low-power operation (0.50" 88x48 module, 3.3 V, estimates from typical
+ * CH1115/SH1106 panel figures, not measured on this board):
+ *
+ *   mode                                   panel + controller current
+ *   NORMAL, 48 rows, ~10% pixels lit       ~1.5 mA (at contrast 0x7F)
+ *   LOW,    48 rows, ~10% pixels lit       ~1.0 mA
+ *   LOW,    16 active rows (timestamp)     ~0.5 mA
+ *   suspended, charge pump on              ~20 uA
+ *   suspended, charge pump off             < 5 uA
+ *
+ * Lit-pixel count and contrast dominate the on current; fewer scanned rows
+ * also cut the COM driver switching losses.
+ */
+enum ch1115_power_mode {
+	/* Timing from ch1115_init(). */
+	CH1115_POWER_NORMAL = 0,
+	/* Lower oscillator frequency, shorter pre-charge, lower VCOMH. */
+	CH1115_POWER_LOW = 1,
+};
+
+int ch1115_set_power_mode(const struct device *dev, enum ch1115_power_mode mode);
+
+/**
+ * Scan only rows [y, y + height) (multiplex ratio, at least 16 rows); rows
+ * outside the window stay dark. Content keeps its position. Resets the start
+ * line set by ch1115_set_start_line() to the window's first panel row.
+ * height = 0 restores all rows. The window is placed for the orientation and
+ * mirrors in effect at the call; call again after changing them.
+ */
+int ch1115_set_active_rows(const struct device *dev, uint16_t y, uint16_t height);
+
+/**
+ * Mirror the panel axes in hardware (segment remap / COM scan direction),
+ * on top of the current orientation. Apps draw in natural coordinates and
+ * pay nothing per pixel. The shown frame is resent once at the new mapping.
+ */
+int ch1115_set_mirror(const struct device *dev, bool mirror_x, bool mirror_y);
+
+/**
+ * Command batching. Between ch1115_batch_begin() and ch1115_batch_end(),
+ * settings made through the display API (contrast, pixel format, blanking,
+ * orientation) and the ch1115_* setters are queued and sent as one command
+ * transaction, e.g. a scene change that flips contrast and inversion:
+ *
+ *   ch1115_batch_begin(dev);
+ *   display_set_contrast(dev, 0x20);
+ *   display_set_pixel_format(dev, PIXEL_FORMAT_MONO10);
+ *   ch1115_batch_end(dev);
+ *
+ * Queued calls return 0 and ch1115_batch_end() reports the bus result. The
+ * batch holds the driver lock, so other threads' display calls wait for it;
+ * ch1115_batch_end() from any other thread returns -EPERM.
+ * Pixel writes inside a batch send the queued commands first. Batches nest.
+ */
+int ch1115_batch_begin(const struct device *dev);
+
+int ch1115_batch_end(const struct device *dev);
+
+/*
+ * I2C bus bring-up (CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE).
+ * ch1115_bus_probe() steps the bus through 100 kHz, 400 kHz and 1 MHz, stops
+ * at the first rate whose test frames fail, leaves the bus at the fastest
+ * stable rate and redraws the shown frame. If no rate is stable the bus goes
+ * back to the configuration it had on entry; the frame is redrawn either way.
+ */
+#define CH1115_BUS_PROBE_STEPS 3
+
+enum ch1115_bus_verify {
+	CH1115_BUS_VERIFY_ACK = 0, /* every transfer ACKed, content not checked */
+	CH1115_BUS_VERIFY_READBACK,
+	CH1115_BUS_VERIFY_EMUL,    /* compared against the emulator GDDRAM */
+};
+
+struct ch1115_bus_probe_step {
+	uint32_t freq_hz;
+	int err;             /* 0 = stable; -EIO bus error; -EBADMSG mismatch */
+	uint32_t fps_x10;    /* full frames per second x10 at this rate */
+};
+
+struct ch1115_bus_probe_result {
+	enum ch1115_bus_verify verify;
+	uint32_t max_stable_hz;  /* 0 if none was stable */
+	uint8_t steps_run;
+	struct ch1115_bus_probe_step steps[CH1115_BUS_PROBE_STEPS];
+};
+
+int ch1115_bus_probe(const struct device *dev, struct ch1115_bus_probe_result *result);
+
+/** Switch the display bus to 100000, 400000 or 1000000 Hz. */
+int ch1115_set_bus_freq(const struct device *dev, uint32_t freq_hz);
+
+/** Rate set by a probe, ch1115_set_bus_freq() or settings; 0 = devicetree rate. */
+uint32_t ch1115_get_bus_freq(const struct device *dev);
+
+/**
+ * Hardware vertical scroll: set the GDDRAM row shown on the first line
+ * (0..63). While the device is suspended the line is kept and sent on resume.
+ */
+int ch1115_set_start_line(const struct device *dev, uint8_t line);
+
+#ifdef __cplusplus
+}
+#endif
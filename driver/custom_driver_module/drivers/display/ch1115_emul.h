@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/drivers/emul.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * I2C emulator for the solomon,ch1115 binding.
+ *
+ * The emulator decodes the command/data streams sent by the CH1115 driver
+ * into a simulated 128x64 GDDRAM, so the LVGL app and simple_ui can run on
+ * native_sim without the OLED. Frames can be pulled out as VTILED bytes (same
+ * layout as the driver's write buffers) or as a binary PBM (P4) image.
+ */
+
+/** Decoded controller registers. */
+struct ch1115_emul_state {
+	bool display_on;
+	bool inverted;
+	bool entire_on;
+	bool segment_remap;
+	bool com_invdir;
+	uint8_t contrast;
+	uint8_t start_line;
+	uint8_t multiplex_ratio;
+	uint8_t display_offset;
+	uint8_t clock_div;
+	uint8_t precharge;
+	uint8_t com_pins;
+	uint8_t vcomh;
+	uint8_t dcdc;
+	uint8_t pump_voltage;
+	uint8_t iref;
+	uint8_t breathing;
+	uint8_t page;
+	uint8_t column;
+};
+
+/** Bus traffic counters since boot or the last reset. */
+struct ch1115_emul_stats {
+	uint32_t transactions;
+	uint32_t cmd_bytes;
+	uint32_t data_bytes;
+	uint32_t unknown_cmds;
+	/* Estimated wire time at the bus rate in effect for each transfer. */
+	uint64_t bus_time_us;
+};
+
+/** One logged I2C transaction. */
+struct ch1115_emul_xfer {
+	int64_t timestamp_us;
+	uint16_t len;  /* payload bytes, control bytes included */
+	uint8_t ctrl;  /* first control byte (0x00 = commands, 0x40 = data) */
+};
+
+void ch1115_emul_get_state(const struct emul *target, struct ch1115_emul_state *state);
+
+void ch1115_emul_get_stats(const struct emul *target, struct ch1115_emul_stats *stats);
+
+/** Clear counters and the transaction log (GDDRAM is kept). */
+void ch1115_emul_reset_stats(const struct emul *target);
+
+/**
+ * Copy the most recent transactions, oldest first.
+ * @return number of entries written to @p out.
+ */
+size_t ch1115_emul_get_log(const struct emul *target, struct ch1115_emul_xfer *out, size_t max);
+
+/**
+ * Copy raw GDDRAM bytes of one page, independent of any display mapping.
+ * Used by the driver's bus probe to verify what arrived on the emulated bus.
+ */
+int ch1115_emul_read_gddram(const struct emul *target, uint8_t page, uint8_t col, uint8_t *buf,
+			    size_t len);
+
+/**
+ * Copy the visible panel area as VTILED bytes (width * height / 8).
+ * Segment remap and COM direction (relative to devicetree), start line and the scanned row window
+ * (multiplex ratio / display offset) are applied; display on/off and
+ * inversion are not (see ch1115_emul_write_pbm()).
+ */
+int ch1115_emul_get_frame(const struct emul *target, uint8_t *buf, size_t len);
+
+/**
+ * Render what the panel shows as a binary PBM (P4). Lit pixels are written
+ * as 0 (white) and unlit ones as 1 (black), like the physical screen and the
+ * frames dumped by driver/tools/simple_ui_host.c.
+ * @return number of bytes written, or -ENOSPC if @p len is too small.
+ */
+int ch1115_emul_write_pbm(const struct emul *target, uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,540 @@
+#define DT_DRV_COMPAT solomon_ch1115
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "display/ch1115_emul.h"
+
+LOG_MODULE_REGISTER(ch1115_emul, LOG_LEVEL_ERR);
+
+/* CH1115 GDDRAM: 128 segments x 64 COM rows (8 pages). */
+#define CH1115_EMUL_COLS  128U
+#define CH1115_EMUL_PAGES 8U
+#define CH1115_EMUL_ROWS  (CH1115_EMUL_PAGES * 8U)
+
+/* Control byte bits (I2C mode). */
+#define CH1115_CTRL_CO BIT(7)
+#define CH1115_CTRL_DC BIT(6)
+
+#define CH1115_EMUL_MAX_ARGS 6
+
+struct ch1115_emul_cfg {
+    uint16_t width;
+    uint16_t height;
+    uint8_t segment_offset;
+    uint8_t page_offset;
+    uint8_t display_offset;
+    /* Module wiring: the devicetree remap/scan direction shows an upright image. */
+    bool segment_remap;
+    bool com_invdir;
+    /* Bus node clock-frequency, for a controller that can't report its config. */
+    uint32_t bus_freq;
+};
+
+struct ch1115_emul_data {
+    struct k_spinlock lock;
+    /* Emulated I2C controller; its current speed times the transfers. */
+    const struct device *bus;
+
+    uint8_t gddram[CH1115_EMUL_PAGES][CH1115_EMUL_COLS];
+    struct ch1115_emul_state state;
+
+    /* Multi-byte command decoder. */
+    uint8_t pending_cmd;
+    uint8_t args_needed;
+    uint8_t args_got;
+    uint8_t args[CH1115_EMUL_MAX_ARGS];
+
+    struct ch1115_emul_stats stats;
+    struct ch1115_emul_xfer log[CONFIG_CUSTOM_OLED_DISPLAY_128X64_EMUL_LOG_SIZE];
+    uint32_t log_count;
+};
+
+static uint8_t ch1115_emul_cmd_args(uint8_t cmd)
+{
+    switch (cmd) {
+    case 0x23: /* breathing light */
+    case 0x81: /* contrast */
+    case 0x82: /* IREF */
+    case 0xA8: /* multiplex ratio */
+    case 0xAD: /* DC-DC control */
+    case 0xD3: /* display offset */
+    case 0xD5: /* oscillator / clock divide */
+    case 0xD9: /* pre-charge period */
+    case 0xDA: /* COM pins */
+    case 0xDB: /* VCOMH deselect level */
+        return 1;
+    case 0x2C: /* content scroll right */
+    case 0x2D: /* content scroll left */
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+static void ch1115_emul_scroll(struct ch1115_emul_data *data, bool left, const uint8_t *args)
+{
+    /* args: dummy, start page, dummy, end page, start column, end column */
+    uint8_t p0 = args[1] & 0x07;
+    uint8_t p1 = args[3] & 0x07;
+    uint8_t c0 = args[4] & 0x7F;
+    uint8_t c1 = args[5] & 0x7F;
+
+    if (p1 < p0 || c1 <= c0) {
+        return;
+    }
+
+    for (uint8_t p = p0; p <= p1; p++) {
+        uint8_t *row = &data->gddram[p][c0];
+        size_t n = (size_t)(c1 - c0);
+        uint8_t tmp;
+
+        if (left) {
+            tmp = row[0];
+            memmove(&row[0], &row[1], n);
+            row[n] = tmp;
+        } else {
+            tmp = row[n];
+            memmove(&row[1], &row[0], n);
+            row[0] = tmp;
+        }
+    }
+}
+
+static void ch1115_emul_exec(struct ch1115_emul_data *data, uint8_t cmd, const uint8_t *args)
+{
+    struct ch1115_emul_state *s = &data->state;
+
+    if (cmd <= 0x0F) {
+        s->column = (uint8_t)((s->column & 0xF0) | (cmd & 0x0F));
+        return;
+    }
+    if (cmd <= 0x17) {
+        s->column = (uint8_t)((s->column & 0x0F) | ((cmd & 0x07) << 4));
+        return;
+    }
+    if (cmd >= 0x30 && cmd <= 0x33) {
+        s->pump_voltage = cmd & 0x03;
+        return;
+    }
+    if (cmd >= 0x40 && cmd <= 0x7F) {
+        s->start_line = cmd & 0x3F;
+        return;
+    }
+    if (cmd >= 0xB0 && cmd <= 0xB7) {
+        s->page = cmd & 0x07;
+        return;
+    }
+    if (cmd >= 0xC0 && cmd <= 0xCF) {
+        s->com_invdir = (cmd & 0x08) != 0;
+        return;
+    }
+
+    switch (cmd) {
+    case 0x23:
+        s->breathing = args[0];
+        break;
+    case 0x2C:
+    case 0x2D:
+        ch1115_emul_scroll(data, cmd == 0x2D, args);
+        break;
+    case 0x81:
+        s->contrast = args[0];
+        break;
+    case 0x82:
+        s->iref = args[0];
+        break;
+    case 0xA0:
+    case 0xA1:
+        s->segment_remap = (cmd & 0x01) != 0;
+        break;
+    case 0xA4:
+    case 0xA5:
+        s->entire_on = (cmd & 0x01) != 0;
+        break;
+    case 0xA6:
+    case 0xA7:
+        s->inverted = (cmd & 0x01) != 0;
+        break;
+    case 0xA8:
+        s->multiplex_ratio = args[0] & 0x3F;
+        break;
+    case 0xAD:
+        s->dcdc = args[0];
+        break;
+    case 0xAE:
+    case 0xAF:
+        s->display_on = (cmd & 0x01) != 0;
+        break;
+    case 0xD3:
+        s->display_offset = args[0] & 0x3F;
+        break;
+    case 0xD5:
+        s->clock_div = args[0];
+        break;
+    case 0xD9:
+        s->precharge = args[0];
+        break;
+    case 0xDA:
+        s->com_pins = args[0];
+        break;
+    case 0xDB:
+        s->vcomh = args[0];
+        break;
+    case 0xE3: /* NOP */
+        break;
+    default:
+        data->stats.unknown_cmds++;
+        LOG_WRN("unknown command 0x%02x", cmd);
+        break;
+    }
+}
+
+static void ch1115_emul_cmd_byte(struct ch1115_emul_data *data, uint8_t b)
+{
+    if (data->args_needed > 0U) {
+        data->args[data->args_got++] = b;
+        if (data->args_got == data->args_needed) {
+            data->args_needed = 0U;
+            ch1115_emul_exec(data, data->pending_cmd, data->args);
+        }
+        return;
+    }
+
+    uint8_t n = ch1115_emul_cmd_args(b);
+    if (n > 0U) {
+        data->pending_cmd = b;
+        data->args_needed = n;
+        data->args_got = 0U;
+        return;
+    }
+
+    ch1115_emul_exec(data, b, NULL);
+}
+
+static void ch1115_emul_data_byte(struct ch1115_emul_data *data, uint8_t b)
+{
+    struct ch1115_emul_state *s = &data->state;
+
+    data->gddram[s->page][s->column] = b;
+    /* Column address auto-increments and wraps inside the page. */
+    s->column = (uint8_t)((s->column + 1U) % CH1115_EMUL_COLS);
+}
+
+/* Rate the driver last set with i2c_configure(), e.g. during a bus probe. */
+static uint32_t ch1115_emul_bus_hz(const struct ch1115_emul_data *data,
+                                   const struct ch1115_emul_cfg *cfg)
+{
+    uint32_t dev_config;
+
+    if (data->bus == NULL || i2c_get_config(data->bus, &dev_config) < 0) {
+        return cfg->bus_freq;
+    }
+
+    switch (I2C_SPEED_GET(dev_config)) {
+    case I2C_SPEED_STANDARD:
+        return I2C_BITRATE_STANDARD;
+    case I2C_SPEED_FAST:
+        return I2C_BITRATE_FAST;
+    case I2C_SPEED_FAST_PLUS:
+        return I2C_BITRATE_FAST_PLUS;
+    case I2C_SPEED_HIGH:
+        return I2C_BITRATE_HIGH;
+    case I2C_SPEED_ULTRA:
+        return I2C_BITRATE_ULTRA;
+    default:
+        return cfg->bus_freq;
+    }
+}
+
+static void ch1115_emul_log(struct ch1115_emul_data *data, uint32_t bus_hz, uint8_t ctrl,
+                            size_t len)
+{
+    struct ch1115_emul_xfer *x = &data->log[data->log_count % ARRAY_SIZE(data->log)];
+
+    x->timestamp_us = k_ticks_to_us_floor64(k_uptime_ticks());
+    x->len = (uint16_t)MIN(len, UINT16_MAX);
+    x->ctrl = ctrl;
+    data->log_count++;
+
+    /* Address byte + payload, 9 clocks per byte, plus START/STOP. */
+    uint64_t bits = ((uint64_t)len + 1U) * 9U + 2U;
+    data->stats.bus_time_us += (bits * 1000000U) / bus_hz;
+    data->stats.transactions++;
+}
+
+static int ch1115_emul_transfer(const struct emul *target, struct i2c_msg *msgs, int num_msgs,
+                                int addr)
+{
+    struct ch1115_emul_data *data = target->data;
+    const struct ch1115_emul_cfg *cfg = target->cfg;
+    bool expect_ctrl = true;
+    bool co = false;
+    bool dc = false;
+    uint8_t first_ctrl = 0U;
+    size_t total = 0U;
+
+    ARG_UNUSED(addr);
+
+    for (int i = 0; i < num_msgs; i++) {
+        if ((msgs[i].flags & I2C_MSG_READ) != 0U) {
+            /* The controller is write-only in I2C mode. */
+            return -EIO;
+        }
+    }
+
+    const uint32_t bus_hz = ch1115_emul_bus_hz(data, cfg);
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    for (int i = 0; i < num_msgs; i++) {
+        for (uint32_t j = 0; j < msgs[i].len; j++) {
+            uint8_t b = msgs[i].buf[j];
+
+            if (expect_ctrl) {
+                if (total == 0U) {
+                    first_ctrl = b;
+                }
+                co = (b & CH1115_CTRL_CO) != 0U;
+                dc = (b & CH1115_CTRL_DC) != 0U;
+                expect_ctrl = false;
+            } else {
+                if (dc) {
+                    ch1115_emul_data_byte(data, b);
+                    data->stats.data_bytes++;
+                } else {
+                    ch1115_emul_cmd_byte(data, b);
+                    data->stats.cmd_bytes++;
+                }
+                /* Co=1: exactly one byte follows before the next control byte. */
+                expect_ctrl = co;
+            }
+            total++;
+        }
+    }
+
+    ch1115_emul_log(data, bus_hz, first_ctrl, total);
+
+    k_spin_unlock(&data->lock, key);
+    return 0;
+}
+
+/* First panel row of the scanned window (moved by changing the display offset). */
+static uint32_t ch1115_emul_window(const struct ch1115_emul_data *data,
+                                   const struct ch1115_emul_cfg *cfg)
+{
+    return ((uint32_t)data->state.display_offset - cfg->display_offset) % CH1115_EMUL_ROWS;
+}
+
+static bool ch1115_emul_row_active(const struct ch1115_emul_data *data,
+                                   const struct ch1115_emul_cfg *cfg, uint16_t y)
+{
+    uint32_t rel = ((uint32_t)y + CH1115_EMUL_ROWS - ch1115_emul_window(data, cfg)) %
+                   CH1115_EMUL_ROWS;
+
+    return rel <= data->state.multiplex_ratio;
+}
+
+static uint8_t ch1115_emul_pixel(const struct ch1115_emul_data *data,
+                                 const struct ch1115_emul_cfg *cfg, uint16_t x, uint16_t y)
+{
+    const struct ch1115_emul_state *s = &data->state;
+    uint32_t seg = (uint32_t)cfg->segment_offset + x;
+    uint32_t col = (s->segment_remap != cfg->segment_remap) ? (CH1115_EMUL_COLS - 1U - seg)
+                                                            : seg;
+    uint32_t row = (s->com_invdir != cfg->com_invdir) ? (uint32_t)(cfg->height - 1U - y) : y;
+
+    /*
+     * The devicetree display offset describes how the module is wired to the
+     * COM lines; only a change against it moves the scanned window, and the
+     * start line selects the RAM row shown on the window's first line.
+     */
+    row = (row + (uint32_t)cfg->page_offset * 8U + s->start_line + CH1115_EMUL_ROWS -
+           ch1115_emul_window(data, cfg)) % CH1115_EMUL_ROWS;
+    col %= CH1115_EMUL_COLS;
+
+    return (uint8_t)((data->gddram[row / 8U][col] >> (row % 8U)) & 0x1U);
+}
+
+void ch1115_emul_get_state(const struct emul *target, struct ch1115_emul_state *state)
+{
+    struct ch1115_emul_data *data = target->data;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    *state = data->state;
+    k_spin_unlock(&data->lock, key);
+}
+
+void ch1115_emul_get_stats(const struct emul *target, struct ch1115_emul_stats *stats)
+{
+    struct ch1115_emul_data *data = target->data;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    *stats = data->stats;
+    k_spin_unlock(&data->lock, key);
+}
+
+void ch1115_emul_reset_stats(const struct emul *target)
+{
+    struct ch1115_emul_data *data = target->data;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    memset(&data->stats, 0, sizeof(data->stats));
+    data->log_count = 0U;
+    k_spin_unlock(&data->lock, key);
+}
+
+size_t ch1115_emul_get_log(const struct emul *target, struct ch1115_emul_xfer *out, size_t max)
+{
+    struct ch1115_emul_data *data = target->data;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    size_t avail = MIN((size_t)data->log_count, ARRAY_SIZE(data->log));
+    size_t n = MIN(avail, max);
+    uint32_t first = data->log_count - (uint32_t)n;
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = data->log[(first + i) % ARRAY_SIZE(data->log)];
+    }
+
+    k_spin_unlock(&data->lock, key);
+    return n;
+}
+
+int ch1115_emul_read_gddram(const struct emul *target, uint8_t page, uint8_t col, uint8_t *buf,
+                            size_t len)
+{
+    struct ch1115_emul_data *data = target->data;
+
+    if (buf == NULL || page >= CH1115_EMUL_PAGES || (col + len) > CH1115_EMUL_COLS) {
+        return -EINVAL;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    memcpy(buf, &data->gddram[page][col], len);
+    k_spin_unlock(&data->lock, key);
+    return 0;
+}
+
+int ch1115_emul_get_frame(const struct emul *target, uint8_t *buf, size_t len)
+{
+    struct ch1115_emul_data *data = target->data;
+    const struct ch1115_emul_cfg *cfg = target->cfg;
+    size_t need = (size_t)cfg->width * cfg->height / 8U;
+
+    if (buf == NULL || len < need) {
+        return -ENOSPC;
+    }
+
+    memset(buf, 0, need);
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    for (uint16_t y = 0; y < cfg->height; y++) {
+        for (uint16_t x = 0; x < cfg->width; x++) {
+            if (ch1115_emul_row_active(data, cfg, y) &&
+                ch1115_emul_pixel(data, cfg, x, y) != 0U) {
+                buf[(y / 8U) * cfg->width + x] |= (uint8_t)BIT(y % 8U);
+            }
+        }
+    }
+    k_spin_unlock(&data->lock, key);
+
+    return 0;
+}
+
+int ch1115_emul_write_pbm(const struct emul *target, uint8_t *buf, size_t len)
+{
+    struct ch1115_emul_data *data = target->data;
+    const struct ch1115_emul_cfg *cfg = target->cfg;
+    size_t stride = (cfg->width + 7U) / 8U;
+    int hdr;
+
+    if (buf == NULL) {
+        return -EINVAL;
+    }
+
+    hdr = snprintf((char *)buf, len, "P4\n%u %u\n", cfg->width, cfg->height);
+    if (hdr < 0 || (size_t)hdr + stride * cfg->height > len) {
+        return -ENOSPC;
+    }
+
+    uint8_t *out = buf + hdr;
+    memset(out, 0, stride * cfg->height);
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    const struct ch1115_emul_state *s = &data->state;
+
+    for (uint16_t y = 0; y < cfg->height; y++) {
+        for (uint16_t x = 0; x < cfg->width; x++) {
+            uint8_t lit;
+
+            if (!s->display_on || !ch1115_emul_row_active(data, cfg, y)) {
+                lit = 0U;
+            } else if (s->entire_on) {
+                lit = 1U;
+            } else {
+                lit = ch1115_emul_pixel(data, cfg, x, y) ^ (s->inverted ? 1U : 0U);
+            }
+
+            /* PBM 1 = black: unlit pixels are black, lit ones white, as on the panel. */
+            if (lit == 0U) {
+                out[y * stride + x / 8U] |= (uint8_t)(0x80U >> (x % 8U));
+            }
+        }
+    }
+    k_spin_unlock(&data->lock, key);
+
+    return hdr + (int)(stride * cfg->height);
+}
+
+static int ch1115_emul_init(const struct emul *target, const struct device *parent)
+{
+    struct ch1115_emul_data *data = target->data;
+
+    data->bus = parent;
+    memset(data->gddram, 0, sizeof(data->gddram));
+    memset(&data->state, 0, sizeof(data->state));
+    memset(&data->stats, 0, sizeof(data->stats));
+    data->log_count = 0U;
+    data->args_needed = 0U;
+
+    /* Power-on reset values. */
+    data->state.contrast = 0x80;
+    data->state.multiplex_ratio = 63;
+    data->state.clock_div = 0x50;
+    data->state.precharge = 0x22;
+    data->state.com_pins = 0x12;
+    data->state.vcomh = 0x35;
+    data->state.dcdc = 0x8A;
+
+    return 0;
+}
+
+static const struct i2c_emul_api ch1115_emul_api_i2c = {
+    .transfer = ch1115_emul_transfer,
+};
+
+#define CH1115_EMUL(inst)                                                                        \
+    static struct ch1115_emul_data ch1115_emul_data_##inst;                                    \
+    static const struct ch1115_emul_cfg ch1115_emul_cfg_##inst = {                             \
+        .width = DT_INST_PROP(inst, width),                                                  \
+        .height = DT_INST_PROP(inst, height),                                                \
+        .segment_offset = DT_INST_PROP_OR(inst, segment_offset, 0),                          \
+        .page_offset = DT_INST_PROP_OR(inst, page_offset, 0),                                \
+        .display_offset = DT_INST_PROP_OR(inst, display_offset, 0),                          \
+        .segment_remap = DT_INST_PROP_OR(inst, segment_remap, 0) != 0,                       \
+        .com_invdir = DT_INST_PROP_OR(inst, com_invdir, 0) != 0,                             \
+        .bus_freq = DT_PROP_OR(DT_INST_BUS(inst), clock_frequency, I2C_BITRATE_STANDARD),    \
+    };                                                                                         \
+    EMUL_DT_INST_DEFINE(inst, ch1115_emul_init, &ch1115_emul_data_##inst,                      \
+                        &ch1115_emul_cfg_##inst, &ch1115_emul_api_i2c, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(CH1115_EMUL)
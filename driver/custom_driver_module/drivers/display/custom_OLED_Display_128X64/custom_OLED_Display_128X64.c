@@ -11,15 +11,132 @@
 #include <errno.h>
 #include <string.h>
 
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_SETTINGS
+#include <zephyr/settings/settings.h>
+#endif
+
+#include "display/ch1115.h"
+#include "display/mono_bitops.h"
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_EMUL
+#include "display/ch1115_emul.h"
+#endif
+
 /* Keep the driver quiet for FPS testing; only report errors. */
 LOG_MODULE_REGISTER(ch1115, LOG_LEVEL_ERR);
 
 #define DT_DRV_COMPAT solomon_ch1115
 
+/* Content scroll by one column (SSD1309-style, needs the column-scroll DT flag). */
+#define CH1115_CMD_SCROLL_RIGHT 0x2C
+#define CH1115_CMD_SCROLL_LEFT  0x2D
+
+/* DC-DC (charge pump) control: 0xAD followed by on/off. */
+#define CH1115_CMD_DCDC  0xAD
+#define CH1115_DCDC_ON   0x8B
+#define CH1115_DCDC_OFF  0x8A
+
+/* Timing settings used by ch1115_init() (NORMAL) and the LOW power mode. */
+#define CH1115_CLOCK_DIV_NORMAL 0x80
+#define CH1115_CLOCK_DIV_LOW    0x40 /* lower oscillator frequency, ~half frame rate */
+#define CH1115_PRECHARGE_LOW    0x11
+#define CH1115_VCOMH_NORMAL     0x40
+#define CH1115_VCOMH_LOW        0x20
+
+/* The controller needs at least 16 multiplexed rows. */
+#define CH1115_MIN_ACTIVE_ROWS 16
+
+#define CH1115_MAX_PAGES 8
+#define CH1115_MAX_COLS  128
+/* Page run: page + column commands as Co=1 pairs, then one data stream. */
+#define CH1115_RUN_HDR_LEN 7
+/* Queued command bytes between ch1115_batch_begin() and ch1115_batch_end(). */
+#define CH1115_BATCH_MAX 32
+
+/*
+ * Power-on sequence, built at compile time from devicetree and kept in flash.
+ * Vendor init sequence for CH1115-based 0.50" 88x48 modules.
+ */
+#define CH1115_INIT_CMDS(inst)                                                                   \
+    {                                                                                          \
+        0xAE,                                                                                  \
+        0x00,                                                                                  \
+        0x10,                                                                                  \
+        0x40,                                                                                  \
+        0xB0,                                                                                  \
+        0x81,                                                                                  \
+        0x80,                                                                                  \
+        0x82,                                                                                  \
+        0x00,                                                                                  \
+        0x23,                                                                                  \
+        0x01,                                                                                  \
+        (DT_INST_PROP_OR(inst, segment_remap, 0) ? 0xA1 : 0xA0),                               \
+        0xA2,                                                                                  \
+        (DT_INST_PROP_OR(inst, com_invdir, 0) ? 0xC8 : 0xC0),                                  \
+        0xA8,                                                                                  \
+        DT_INST_PROP_OR(inst, multiplex_ratio, 47),                                            \
+        0xD3,                                                                                  \
+        DT_INST_PROP_OR(inst, display_offset, 0),                                              \
+        0xD5,                                                                                  \
+        CH1115_CLOCK_DIV_NORMAL,                                                               \
+        0xD9,                                                                                  \
+        DT_INST_PROP_OR(inst, prechargep, 0x22),                                               \
+        0xDA,                                                                                  \
+        0x12,                                                                                  \
+        0xDB,                                                                                  \
+        CH1115_VCOMH_NORMAL,                                                                   \
+        CH1115_CMD_DCDC,                                                                       \
+        CH1115_DCDC_ON,                                                                        \
+        0x33,                                                                                  \
+        0xA4,                                                                                  \
+        0xA6,                                                                                  \
+        0xAF,                                                                                  \
+    }
+
 struct ch1115_data {
+    const struct device *dev;
     enum display_pixel_format pf;
-    uint8_t *clear_buf;
+    /* Copy of the visible GDDRAM window, VTILED, width bytes per page. */
+    uint8_t *shadow;
+	/*
+	 * Panel off (PM suspend). Drawing continues into the shadow and dirty
+	 * ranges; resume replays only those before switching the panel on.
+	 */
 	bool suspended;
+	/* Start line (0x40..0x7F) last set, and whether resume still owes it. */
+	uint8_t start_line;
+	bool start_line_pending;
+
+    /* Guards shadow, dirty ranges and stats against the flush work. */
+    struct k_mutex lock;
+    struct k_work_delayable flush_work;
+    uint32_t frame_interval_ms;
+    /* Per-page dirty column range [x0, x1); clean when x0 >= x1. */
+    uint8_t dirty_x0[CH1115_MAX_PAGES];
+    uint8_t dirty_x1[CH1115_MAX_PAGES];
+    uint8_t run_buf[CH1115_RUN_HDR_LEN + CH1115_MAX_COLS];
+    struct ch1115_stats stats;
+
+    enum ch1115_power_mode power_mode;
+
+    /* Open batch nesting depth, queued command bytes and first queue error. */
+    uint8_t batch_depth;
+    uint8_t batch_len;
+    int batch_err;
+    uint8_t batch_buf[CH1115_BATCH_MAX];
+
+    /*
+     * Orientation: 180 degrees and mirrors are segment remap / COM direction
+     * flips relative to devicetree; 90/270 add a software 8x8 transpose.
+     * col_offset is the GDDRAM column of logical x = 0 under the current remap.
+     */
+    enum display_orientation orientation;
+    bool mirror_x;
+    bool mirror_y;
+    bool transpose;
+    uint8_t col_offset;
+
+    /* Bus rate chosen at runtime; 0 while the devicetree rate is in use. */
+    uint32_t bus_hz;
 };
 
 static uint32_t ch1115_fps_value;
@@ -72,20 +189,123 @@ struct ch1115_config {
     uint8_t prechargep;
     uint8_t segment_remap;
     uint8_t com_invdir;
+    bool column_scroll;
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE
+    /* Controller config for the bus node's clock-frequency. */
+    uint32_t bus_dt_cfg;
+#endif
+    const uint8_t *init_cmds;
+    uint8_t init_cmds_len;
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_EMUL
+    const struct emul *emul;
+#endif
 };
 
-static inline int ch1115_write_cmds(const struct device *dev, const uint8_t *cmds, size_t len)
+/* Send the queued batch as one command transaction. Caller holds data->lock. */
+static int ch1115_batch_emit(const struct device *dev)
 {
     const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    int ret;
+
+    if (data->batch_len == 0U) {
+        return 0;
+    }
 
-    return i2c_burst_write_dt(&config->i2c, 0x00, cmds, len);
+    ret = i2c_burst_write_dt(&config->i2c, 0x00, data->batch_buf, data->batch_len);
+    data->batch_len = 0U;
+    return ret;
 }
 
-static inline int ch1115_write_data(const struct device *dev, const uint8_t *data, size_t len)
+static int ch1115_write_cmds(const struct device *dev, const uint8_t *cmds, size_t len)
 {
     const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    if (data->batch_depth == 0U) {
+        ret = i2c_burst_write_dt(&config->i2c, 0x00, cmds, len);
+    } else if (len > sizeof(data->batch_buf)) {
+        ret = ch1115_batch_emit(dev);
+        if (ret == 0) {
+            ret = i2c_burst_write_dt(&config->i2c, 0x00, cmds, len);
+        }
+    } else {
+        if ((size_t)data->batch_len + len > sizeof(data->batch_buf)) {
+            ret = ch1115_batch_emit(dev);
+        }
+        if (ret == 0) {
+            memcpy(&data->batch_buf[data->batch_len], cmds, len);
+            data->batch_len += (uint8_t)len;
+        }
+    }
+
+    if (ret < 0 && data->batch_depth > 0U && data->batch_err == 0) {
+        data->batch_err = ret;
+    }
+
+    k_mutex_unlock(&data->lock);
+    return ret;
+}
+
+/* GDDRAM transfer timing for stats.bus_cycles (CONFIG_..._BUS_TIMING). */
+static inline uint32_t ch1115_bus_time_begin(void)
+{
+    return IS_ENABLED(CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_TIMING) ? k_cycle_get_32() : 0U;
+}
+
+static inline void ch1115_bus_time_end(struct ch1115_data *data, uint32_t t0)
+{
+    if (IS_ENABLED(CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_TIMING)) {
+        data->stats.bus_cycles += k_cycle_get_32() - t0;
+    }
+}
 
-    return i2c_burst_write_dt(&config->i2c, 0x40, data, len);
+int ch1115_batch_begin(const struct device *dev)
+{
+    struct ch1115_data *data = dev->data;
+
+    /* Held until the matching ch1115_batch_end(); k_mutex nests per thread. */
+    k_mutex_lock(&data->lock, K_FOREVER);
+    if (data->batch_depth == UINT8_MAX) {
+        k_mutex_unlock(&data->lock);
+        return -EBUSY;
+    }
+
+    if (data->batch_depth++ == 0U) {
+        data->batch_err = 0;
+    }
+    return 0;
+}
+
+int ch1115_batch_end(const struct device *dev)
+{
+    struct ch1115_data *data = dev->data;
+    int ret = 0;
+
+    /* Only the thread holding the batch may close it. */
+    if (data->lock.owner != k_current_get()) {
+        return -EPERM;
+    }
+
+    if (data->batch_depth == 0U) {
+        return -EALREADY;
+    }
+
+    if (--data->batch_depth == 0U) {
+        ret = ch1115_batch_emit(dev);
+        if (data->batch_err < 0) {
+            ret = data->batch_err;
+        }
+        if (ret < 0) {
+            LOG_ERR("batch failed (%d)", ret);
+        }
+    }
+
+    k_mutex_unlock(&data->lock);
+    return ret;
 }
 
 static int ch1115_blanking_on(const struct device *dev)
@@ -121,18 +341,115 @@ static int ch1115_set_contrast(const struct device *dev, const uint8_t contrast)
     return ret;
 }
 
+int ch1115_set_power_mode(const struct device *dev, enum ch1115_power_mode mode)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    uint8_t cmd_buf[6];
+    int ret;
+
+    switch (mode) {
+    case CH1115_POWER_NORMAL:
+        cmd_buf[1] = CH1115_CLOCK_DIV_NORMAL;
+        cmd_buf[3] = config->prechargep;
+        cmd_buf[5] = CH1115_VCOMH_NORMAL;
+        break;
+    case CH1115_POWER_LOW:
+        cmd_buf[1] = CH1115_CLOCK_DIV_LOW;
+        cmd_buf[3] = CH1115_PRECHARGE_LOW;
+        cmd_buf[5] = CH1115_VCOMH_LOW;
+        break;
+    default:
+        return -EINVAL;
+    }
+
+    cmd_buf[0] = 0xD5;
+    cmd_buf[2] = 0xD9;
+    cmd_buf[4] = 0xDB;
+
+    ret = ch1115_write_cmds(dev, cmd_buf, sizeof(cmd_buf));
+    if (ret < 0) {
+        LOG_ERR("set_power_mode failed (%d)", ret);
+        return ret;
+    }
+
+    data->power_mode = mode;
+    return 0;
+}
+
+/* COM scan reversed against devicetree: logical row 0 is the panel's last row. */
+static inline bool ch1115_flip_y(const struct ch1115_data *data)
+{
+    return data->mirror_y ^ (data->orientation == DISPLAY_ORIENTATION_ROTATED_180 ||
+                             data->orientation == DISPLAY_ORIENTATION_ROTATED_270);
+}
+
+int ch1115_set_active_rows(const struct device *dev, uint16_t y, uint16_t height)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    const bool all_rows = (height == 0U);
+    int ret;
+
+    if (all_rows) {
+        y = 0U;
+        height = config->height;
+    }
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    /* Rotated 90/270: logical rows are panel columns, which the COM window can't cut. */
+    if (data->transpose && !all_rows) {
+        k_mutex_unlock(&data->lock);
+        return -ENOTSUP;
+    }
+
+    if (height < CH1115_MIN_ACTIVE_ROWS || (y + height) > config->height) {
+        k_mutex_unlock(&data->lock);
+        return -EINVAL;
+    }
+
+    /* With the COM scan reversed, logical rows [y, y + height) end at the panel bottom. */
+    const uint16_t row = ch1115_flip_y(data) ? (uint16_t)(config->height - y - height) : y;
+
+    /*
+     * Scan only the rows in use. The display offset moves the scanned window
+     * down to panel row `row` and the start line keeps the same RAM row on it,
+     * so content stays where it was drawn and everything outside is dark.
+     */
+    uint8_t cmd_buf[] = {
+        0xA8,
+        (uint8_t)((height == config->height) ? config->multiplex_ratio : (height - 1U)),
+        0xD3,
+        (uint8_t)((config->display_offset + row) & 0x3F),
+        (uint8_t)(0x40 | (row & 0x3F)),
+    };
+
+    ret = ch1115_write_cmds(dev, cmd_buf, sizeof(cmd_buf));
+    if (ret == 0) {
+        data->start_line = (uint8_t)(row & 0x3F);
+        data->start_line_pending = false;
+    }
+    k_mutex_unlock(&data->lock);
+
+    if (ret < 0) {
+        LOG_ERR("set_active_rows failed (%d)", ret);
+    }
+    return ret;
+}
+
 static void ch1115_get_capabilities(const struct device *dev, struct display_capabilities *caps)
 {
     const struct ch1115_config *config = dev->config;
     struct ch1115_data *data = dev->data;
 
-    caps->x_resolution = config->width;
-    caps->y_resolution = config->height;
+    caps->x_resolution = data->transpose ? config->height : config->width;
+    caps->y_resolution = data->transpose ? config->width : config->height;
     caps->supported_pixel_formats = PIXEL_FORMAT_MONO10 | PIXEL_FORMAT_MONO01;
     caps->current_pixel_format = data->pf;
     /* CH1115 uses a page-based memory layout (8 vertical pixels per byte). */
     caps->screen_info = SCREEN_INFO_MONO_VTILED;
-    caps->current_orientation = DISPLAY_ORIENTATION_NORMAL;
+    caps->current_orientation = data->orientation;
 }
 
 static int ch1115_set_pixel_format(const struct device *dev, const enum display_pixel_format pf)
@@ -163,215 +480,1003 @@ static int ch1115_set_pixel_format(const struct device *dev, const enum display_
     return 0;
 }
 
-static int ch1115_set_pos(const struct device *dev, uint8_t x, uint8_t page)
+static void ch1115_shadow_store(const struct device *dev, uint16_t x, uint8_t page,
+                                uint8_t page_count, uint16_t width, uint16_t pitch,
+                                const uint8_t *buf)
 {
-    uint8_t cmd_buf[] = {
-        (uint8_t)(0xB0 | (page & 0x0F)),
-        (uint8_t)(0x00 | (x & 0x0F)),
-        (uint8_t)(0x10 | ((x >> 4) & 0x0F)),
-    };
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
 
-    return ch1115_write_cmds(dev, cmd_buf, sizeof(cmd_buf));
+    for (uint8_t p = 0; p < page_count; p++) {
+        memcpy(&data->shadow[(size_t)(page + p) * config->width + x], &buf[(size_t)p * pitch],
+               width);
+    }
 }
 
-static int ch1115_write(const struct device *dev, const uint16_t x, const uint16_t y,
-             const struct display_buffer_descriptor *desc, const void *buf)
+/* Rotated write: logical VTILED blocks are transposed into panel pages. */
+static void ch1115_shadow_store_transposed(const struct device *dev, uint16_t x, uint16_t y,
+                                           uint16_t width, uint16_t height, uint16_t pitch,
+                                           const uint8_t *buf)
 {
     const struct ch1115_config *config = dev->config;
     struct ch1115_data *data = dev->data;
-    size_t buf_len;
 
-    if (data->suspended) {
-        return -EACCES;
+    /* Logical x becomes panel row (page x / 8), logical y becomes panel column. */
+    for (uint16_t pr = 0; pr < height / 8U; pr++) {
+        for (uint16_t g = 0; g < width / 8U; g++) {
+            uint64_t blk = mono_load8x8(&buf[(size_t)pr * pitch + g * 8U], 1);
+
+            mono_store8x8(&data->shadow[(size_t)(x / 8U + g) * config->width + y + pr * 8U], 1,
+                          mono_transpose8x8(blk));
+        }
     }
+}
 
-    uint8_t page_start;
-    uint8_t page_count;
-    uint8_t col_start;
-    const uint8_t *buf_ptr;
-    int ret;
+static void ch1115_mark_dirty(const struct device *dev, uint16_t x, uint8_t page,
+                              uint8_t page_count, uint16_t width)
+{
+    struct ch1115_data *data = dev->data;
 
-    if (desc->pitch < desc->width) {
-        return -EINVAL;
+    for (uint8_t p = page; p < (uint8_t)(page + page_count); p++) {
+        if (data->dirty_x0[p] >= data->dirty_x1[p]) {
+            data->dirty_x0[p] = (uint8_t)x;
+            data->dirty_x1[p] = (uint8_t)(x + width);
+        } else {
+            data->dirty_x0[p] = (uint8_t)MIN(data->dirty_x0[p], x);
+            data->dirty_x1[p] = (uint8_t)MAX(data->dirty_x1[p], x + width);
+        }
     }
+}
 
-    if (desc->pitch != desc->width) {
-        return -ENOTSUP;
-    }
+static bool ch1115_has_dirty(const struct device *dev)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
 
-    if ((y & 0x7U) != 0U) {
-        return -ENOTSUP;
+    for (uint8_t p = 0; p < (uint8_t)(config->height / 8U); p++) {
+        if (data->dirty_x0[p] < data->dirty_x1[p]) {
+            return true;
+        }
     }
+    return false;
+}
 
-    buf_len = MIN(desc->buf_size, (size_t)(desc->height * desc->width / 8U));
-    if (buf == NULL || buf_len == 0U) {
-        return -EINVAL;
+/* One I2C transaction per page run: position commands and pixel data together. */
+static int ch1115_send_run(const struct device *dev, uint8_t page, uint8_t x, uint8_t len)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    uint8_t col = (uint8_t)(x + data->col_offset);
+    uint8_t *b = data->run_buf;
+    uint32_t t0;
+    int ret;
+
+    ret = ch1115_batch_emit(dev);
+    if (ret < 0) {
+        return ret;
     }
 
-    page_start = (uint8_t)(y / 8U) + config->page_offset;
-    page_count = (uint8_t)(desc->height / 8U);
-    col_start = (uint8_t)x + config->segment_offset;
-    buf_ptr = buf;
+    b[0] = 0x80;
+    b[1] = (uint8_t)(0xB0 | ((page + config->page_offset) & 0x0F));
+    b[2] = 0x80;
+    b[3] = (uint8_t)(0x00 | (col & 0x0F));
+    b[4] = 0x80;
+    b[5] = (uint8_t)(0x10 | ((col >> 4) & 0x0F));
+    b[6] = 0x40;
+
+    t0 = ch1115_bus_time_begin();
+    ret = i2c_write_dt(&config->i2c, b, CH1115_RUN_HDR_LEN + len);
+    ch1115_bus_time_end(data, t0);
+    return ret;
+}
 
-    for (uint8_t page = 0; page < page_count; page++) {
-        ret = ch1115_set_pos(dev, col_start, (uint8_t)(page_start + page));
-        if (ret < 0) {
-            ch1115_trace_write_result(ret);
-            return ret;
+static int ch1115_write_run(const struct device *dev, uint8_t page, uint8_t x, uint8_t len)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+
+    memcpy(&data->run_buf[CH1115_RUN_HDR_LEN], &data->shadow[(size_t)page * config->width + x],
+           len);
+    return ch1115_send_run(dev, page, x, len);
+}
+
+/* Send every dirty page run from the shadow. Caller holds data->lock. */
+static int ch1115_flush_dirty(const struct device *dev)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    int ret;
+
+    for (uint8_t p = 0; p < (uint8_t)(config->height / 8U); p++) {
+        uint8_t x0 = data->dirty_x0[p];
+        uint8_t x1 = data->dirty_x1[p];
+
+        if (x0 >= x1) {
+            continue;
         }
 
-        ret = ch1115_write_data(dev, buf_ptr, desc->width);
+        ret = ch1115_write_run(dev, p, x0, (uint8_t)(x1 - x0));
         if (ret < 0) {
-            ch1115_trace_write_result(ret);
+            /* Keep the range dirty; the next flush retries it. */
             return ret;
         }
 
-        buf_ptr += desc->width;
-        if ((size_t)(buf_ptr - (const uint8_t *)buf) > buf_len) {
-            return -EOVERFLOW;
-        }
+        data->dirty_x0[p] = 0U;
+        data->dirty_x1[p] = 0U;
+        data->stats.bytes_sent += (uint32_t)(x1 - x0);
     }
 
-	ch1115_trace_write_result(0);
-
+    data->stats.flushes++;
     return 0;
 }
 
-static int ch1115_clear(const struct device *dev)
+static void ch1115_flush_work_handler(struct k_work *work)
 {
-    struct ch1115_data *data = dev->data;
-    const struct ch1115_config *config = dev->config;
-
-    if (data->suspended) {
-        return -EACCES;
-    }
-
-    struct display_buffer_descriptor desc = {
-        .buf_size = (size_t)(config->width * config->height / 8U),
-        .width = config->width,
-        .height = config->height,
-        .pitch = config->width,
-    };
+    struct k_work_delayable *dw = k_work_delayable_from_work(work);
+    struct ch1115_data *data = CONTAINER_OF(dw, struct ch1115_data, flush_work);
+    int ret;
 
-    if (data->clear_buf == NULL) {
-        return -ENOMEM;
+    k_mutex_lock(&data->lock, K_FOREVER);
+    if (!data->suspended) {
+        ret = ch1115_flush_dirty(data->dev);
+        ch1115_trace_write_result(ret);
     }
-
-    memset(data->clear_buf, 0x00, desc.buf_size);
-    return ch1115_write(dev, 0, 0, &desc, data->clear_buf);
+    k_mutex_unlock(&data->lock);
 }
 
-static int ch1115_init(const struct device *dev)
+static int ch1115_write(const struct device *dev, const uint16_t x, const uint16_t y,
+             const struct display_buffer_descriptor *desc, const void *buf)
 {
     const struct ch1115_config *config = dev->config;
     struct ch1115_data *data = dev->data;
-    int ret;
+    uint8_t page_start;
+    uint8_t page_count;
+    const uint8_t *buf_ptr;
+    int ret = 0;
 
-    uint8_t init_cmds[] = {
-        0xAE,
-        0x00,
-        0x10,
-        0x40,
-        0xB0,
-        0x81,
-        0x80,
-        0x82,
-        0x00,
-        0x23,
-        0x01,
-        (uint8_t)(config->segment_remap ? 0xA1 : 0xA0),
-        0xA2,
-        (uint8_t)(config->com_invdir ? 0xC8 : 0xC0),
-        0xA8,
-        config->multiplex_ratio,
-        0xD3,
-        config->display_offset,
-        0xD5,
-        0x80,
-        0xD9,
-        config->prechargep,
-        0xDA,
-        0x12,
-        0xDB,
-        0x40,
-        0xAD,
-		/* Vendor init sequence for CH1115-based 0.50\" 88x48 modules */
-		0x8B,
-		0x33,
-        0xA4,
-        0xA6,
-        0xAF,
-    };
+    if (desc->pitch < desc->width) {
+        return -EINVAL;
+    }
 
-    if (!i2c_is_ready_dt(&config->i2c)) {
-        LOG_ERR("I2C bus not ready");
-        return -ENODEV;
+    if ((y & 0x7U) != 0U || (desc->height & 0x7U) != 0U) {
+        return -ENOTSUP;
     }
 
-    /* Intentionally no INFO logs here (keep FPS test quiet). */
+    /* Rotated: x/width turn into panel rows, so they must be page aligned too. */
+    if (data->transpose && ((x & 0x7U) != 0U || (desc->width & 0x7U) != 0U)) {
+        return -ENOTSUP;
+    }
 
-    if (config->reset.port) {
-        if (!gpio_is_ready_dt(&config->reset)) {
-            LOG_ERR("Reset GPIO not ready");
-            return -ENODEV;
-        }
+    if ((x + desc->width) > (data->transpose ? config->height : config->width) ||
+        (y + desc->height) > (data->transpose ? config->width : config->height)) {
+        return -EINVAL;
+    }
 
-        ret = gpio_pin_configure_dt(&config->reset, GPIO_OUTPUT_INACTIVE);
-        if (ret < 0) {
-            return ret;
+    page_count = (uint8_t)(desc->height / 8U);
+    if (buf == NULL || desc->width == 0U || page_count == 0U) {
+        return -EINVAL;
+    }
+
+    /* VTILED: one row of pitch bytes per page; the last row only needs width. */
+    if (desc->buf_size < (size_t)(page_count - 1U) * desc->pitch + desc->width) {
+        return -EOVERFLOW;
+    }
+
+    page_start = (uint8_t)(y / 8U);
+    buf_ptr = buf;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    data->stats.raw_writes++;
+
+    if (data->transpose) {
+        ch1115_shadow_store_transposed(dev, x, y, desc->width, desc->height, desc->pitch, buf);
+        ch1115_mark_dirty(dev, y, (uint8_t)(x / 8U), (uint8_t)(desc->width / 8U),
+                          desc->height);
+    } else {
+        ch1115_shadow_store(dev, x, page_start, page_count, desc->width, desc->pitch, buf);
+        if (data->frame_interval_ms > 0U || data->suspended) {
+            ch1115_mark_dirty(dev, x, page_start, page_count, desc->width);
         }
+    }
 
-        gpio_pin_set_dt(&config->reset, 1);
-        k_sleep(K_MSEC(10));
-        gpio_pin_set_dt(&config->reset, 0);
-        k_sleep(K_MSEC(10));
+    if (data->suspended) {
+        /* Panel is off: keep the update for the resume replay. */
+        k_mutex_unlock(&data->lock);
+        return 0;
     }
 
-    data->pf = PIXEL_FORMAT_MONO01;
-	data->suspended = false;
+    if (data->frame_interval_ms > 0U) {
+        /* Paced: merge into the pending frame; the flush work sends it. */
+        if (k_work_schedule(&data->flush_work, K_MSEC(data->frame_interval_ms)) == 0) {
+            data->stats.coalesced_writes++;
+        }
+        k_mutex_unlock(&data->lock);
+        return 0;
+    }
 
-    ret = ch1115_write_cmds(dev, init_cmds, sizeof(init_cmds));
-    if (ret < 0) {
-        LOG_ERR("Failed to init CH1115 (%d)", ret);
+    if (data->transpose) {
+        /* The panel rectangle is only contiguous in the shadow. */
+        ret = ch1115_flush_dirty(dev);
+        k_mutex_unlock(&data->lock);
+        ch1115_trace_write_result(ret);
         return ret;
     }
 
-    data->clear_buf = k_malloc((size_t)(config->width * config->height / 8U));
-    if (data->clear_buf == NULL) {
-        return -ENOMEM;
+    /* Position and pixels of each page go out as one transaction. */
+    for (uint8_t page = 0; page < page_count; page++) {
+        memcpy(&data->run_buf[CH1115_RUN_HDR_LEN], buf_ptr, desc->width);
+        ret = ch1115_send_run(dev, (uint8_t)(page_start + page), (uint8_t)x,
+                              (uint8_t)desc->width);
+        if (ret < 0) {
+            break;
+        }
+
+        data->stats.bytes_sent += desc->width;
+        buf_ptr += desc->pitch;
     }
 
-    return 0;
+    k_mutex_unlock(&data->lock);
+	ch1115_trace_write_result(ret);
+
+    return ret;
 }
 
-#ifdef CONFIG_PM_DEVICE
-static int ch1115_pm_action(const struct device *dev, enum pm_device_action action)
+/* Send remap/scan direction and move the GDDRAM window to match. */
+static int ch1115_apply_orientation(const struct device *dev, enum display_orientation orientation,
+                                    bool mirror_x, bool mirror_y)
 {
+    const struct ch1115_config *config = dev->config;
     struct ch1115_data *data = dev->data;
-    int ret;
+    bool flip_x = mirror_x ^ (orientation == DISPLAY_ORIENTATION_ROTATED_90 ||
+                              orientation == DISPLAY_ORIENTATION_ROTATED_180);
+    bool flip_y = mirror_y ^ (orientation == DISPLAY_ORIENTATION_ROTATED_180 ||
+                              orientation == DISPLAY_ORIENTATION_ROTATED_270);
+    uint8_t cmd_buf[] = {
+        (uint8_t)(((config->segment_remap != 0U) ^ flip_x) ? 0xA1 : 0xA0),
+        (uint8_t)(((config->com_invdir != 0U) ^ flip_y) ? 0xC8 : 0xC0),
+    };
+    int ret = 0;
 
-    switch (action) {
-    case PM_DEVICE_ACTION_SUSPEND:
-        /* Lowest-risk "sleep": turn display off. RAM is typically retained. */
-        ret = ch1115_blanking_on(dev);
-        if (ret == 0) {
-            data->suspended = true;
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    if (!data->suspended) {
+        ret = ch1115_write_cmds(dev, cmd_buf, sizeof(cmd_buf));
+    }
+
+    if (ret == 0) {
+        data->orientation = orientation;
+        data->mirror_x = mirror_x;
+        data->mirror_y = mirror_y;
+        data->transpose = (orientation == DISPLAY_ORIENTATION_ROTATED_90 ||
+                           orientation == DISPLAY_ORIENTATION_ROTATED_270);
+        /* A remapped panel shows GDDRAM columns from the other end. */
+        data->col_offset = flip_x ? (uint8_t)(CH1115_MAX_COLS - config->width -
+                                              config->segment_offset)
+                                  : config->segment_offset;
+
+        /* Rewrite the whole shadow at the new column window. */
+        ch1115_mark_dirty(dev, 0, 0, (uint8_t)(config->height / 8U), config->width);
+        if (!data->suspended) {
+            ret = ch1115_flush_dirty(dev);
         }
-        return ret;
-    case PM_DEVICE_ACTION_RESUME:
-        /* Wake: turn display on. App can optionally clear/redraw. */
-        ret = ch1115_blanking_off(dev);
-        if (ret == 0) {
-            data->suspended = false;
+    }
+
+    k_mutex_unlock(&data->lock);
+    if (ret < 0) {
+        LOG_ERR("set_orientation failed (%d)", ret);
+    }
+    return ret;
+}
+
+static int ch1115_set_orientation(const struct device *dev,
+                                  const enum display_orientation orientation)
+{
+    struct ch1115_data *data = dev->data;
+
+    switch (orientation) {
+    case DISPLAY_ORIENTATION_NORMAL:
+    case DISPLAY_ORIENTATION_ROTATED_90:
+    case DISPLAY_ORIENTATION_ROTATED_180:
+    case DISPLAY_ORIENTATION_ROTATED_270:
+        break;
+    default:
+        return -ENOTSUP;
+    }
+
+    if (orientation == data->orientation) {
+        return 0;
+    }
+
+    return ch1115_apply_orientation(dev, orientation, data->mirror_x, data->mirror_y);
+}
+
+int ch1115_set_mirror(const struct device *dev, bool mirror_x, bool mirror_y)
+{
+    struct ch1115_data *data = dev->data;
+
+    if (mirror_x == data->mirror_x && mirror_y == data->mirror_y) {
+        return 0;
+    }
+
+    return ch1115_apply_orientation(dev, data->orientation, mirror_x, mirror_y);
+}
+
+int ch1115_set_frame_interval(const struct device *dev, uint32_t interval_ms)
+{
+    struct ch1115_data *data = dev->data;
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    data->frame_interval_ms = interval_ms;
+    if (interval_ms == 0U) {
+        /* Back to write-through: push out whatever is still pending. */
+        (void)k_work_cancel_delayable(&data->flush_work);
+        if (!data->suspended && ch1115_has_dirty(dev)) {
+            ret = ch1115_flush_dirty(dev);
+        }
+    }
+    k_mutex_unlock(&data->lock);
+
+    return ret;
+}
+
+int ch1115_flush(const struct device *dev)
+{
+    struct ch1115_data *data = dev->data;
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    (void)k_work_cancel_delayable(&data->flush_work);
+    /* While suspended the pending frame stays queued for resume. */
+    if (!data->suspended && ch1115_has_dirty(dev)) {
+        ret = ch1115_flush_dirty(dev);
+    }
+    k_mutex_unlock(&data->lock);
+
+    return ret;
+}
+
+void ch1115_get_stats(const struct device *dev, struct ch1115_stats *stats)
+{
+    struct ch1115_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    *stats = data->stats;
+    k_mutex_unlock(&data->lock);
+}
+
+uint32_t ch1115_get_bus_cycles(const struct device *dev)
+{
+    const struct ch1115_data *data = dev->data;
+
+    /* One aligned word, only written under the lock: a plain load is enough. */
+    return *(const volatile uint32_t *)&data->stats.bus_cycles;
+}
+
+void ch1115_reset_stats(const struct device *dev)
+{
+    struct ch1115_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    memset(&data->stats, 0, sizeof(data->stats));
+    k_mutex_unlock(&data->lock);
+}
+
+int ch1115_set_start_line(const struct device *dev, uint8_t line)
+{
+    struct ch1115_data *data = dev->data;
+    uint8_t cmd = (uint8_t)(0x40 | (line & 0x3F));
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    data->start_line = (uint8_t)(line & 0x3F);
+    /* Panel off: kept like the shadow and sent by the resume replay. */
+    data->start_line_pending = data->suspended;
+    if (!data->suspended) {
+        ret = ch1115_write_cmds(dev, &cmd, 1);
+    }
+    k_mutex_unlock(&data->lock);
+    return ret;
+}
+
+int ch1115_scroll(const struct device *dev, enum ch1115_scroll_dir dir, uint16_t y,
+                  uint16_t height)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    uint8_t page_start;
+    uint8_t page_count;
+    int ret;
+
+    if ((y & 0x7U) != 0U || (height & 0x7U) != 0U || height == 0U ||
+        (y + height) > config->height) {
+        return -EINVAL;
+    }
+
+    if (dir != CH1115_SCROLL_LEFT && dir != CH1115_SCROLL_RIGHT) {
+        return -EINVAL;
+    }
+
+    /*
+     * Without the scroll engine the only way to move the band would be to
+     * resend it, which costs more than the caller redrawing what changed.
+     */
+    if (!config->column_scroll) {
+        return -ENOTSUP;
+    }
+
+    page_start = (uint8_t)(y / 8U);
+    page_count = (uint8_t)(height / 8U);
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    /* Rotated 90/270: a logical column shift would move panel rows. */
+    if (data->transpose) {
+        k_mutex_unlock(&data->lock);
+        return -ENOTSUP;
+    }
+
+    /* GDDRAM must hold the latest frame before it is moved in place. */
+    if (!data->suspended && ch1115_has_dirty(dev)) {
+        ret = ch1115_flush_dirty(dev);
+        if (ret < 0) {
+            k_mutex_unlock(&data->lock);
+            return ret;
+        }
+    }
+
+    /* Keep the shadow in step with GDDRAM: rotate each page row by one column. */
+    for (uint8_t p = page_start; p < (uint8_t)(page_start + page_count); p++) {
+        uint8_t *row = &data->shadow[(size_t)p * config->width];
+        uint8_t tmp;
+
+        if (dir == CH1115_SCROLL_LEFT) {
+            tmp = row[0];
+            memmove(&row[0], &row[1], config->width - 1U);
+            row[config->width - 1U] = tmp;
+        } else {
+            tmp = row[config->width - 1U];
+            memmove(&row[1], &row[0], config->width - 1U);
+            row[0] = tmp;
+        }
+    }
+
+    if (data->suspended) {
+        /* Panel off: the rotated band is replayed from the shadow on resume. */
+        ch1115_mark_dirty(dev, 0, page_start, page_count, config->width);
+        k_mutex_unlock(&data->lock);
+        return 0;
+    }
+
+    uint8_t cmd_buf[] = {
+        (uint8_t)(dir == CH1115_SCROLL_LEFT ? CH1115_CMD_SCROLL_LEFT : CH1115_CMD_SCROLL_RIGHT),
+        0x00,
+        (uint8_t)(page_start + config->page_offset),
+        0x01,
+        (uint8_t)(page_start + page_count - 1U + config->page_offset),
+        data->col_offset,
+        (uint8_t)(data->col_offset + config->width - 1U),
+    };
+
+    ret = ch1115_write_cmds(dev, cmd_buf, sizeof(cmd_buf));
+    k_mutex_unlock(&data->lock);
+    if (ret < 0) {
+        LOG_ERR("scroll failed (%d)", ret);
+    }
+    return ret;
+}
+
+int ch1115_fill(const struct device *dev, uint16_t x, uint16_t y, uint16_t width,
+                uint16_t height, bool set)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    uint8_t page_start;
+    uint8_t page_end;
+    int ret = 0;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    /* Rotated 90/270: logical x runs down the panel rows, logical y along the columns. */
+    if (data->transpose) {
+        uint16_t t = x;
+
+        x = y;
+        y = t;
+        t = width;
+        width = height;
+        height = t;
+    }
+
+    if (width == 0U || height == 0U || (x + width) > config->width ||
+        (y + height) > config->height) {
+        k_mutex_unlock(&data->lock);
+        return -EINVAL;
+    }
+
+    page_start = (uint8_t)(y / 8U);
+    page_end = (uint8_t)((y + height - 1U) / 8U);
+
+    /* Fill the shadow; edge pages that are only partly covered get a mask. */
+    for (uint8_t p = page_start; p <= page_end; p++) {
+        uint16_t row0 = MAX(y, (uint16_t)(p * 8U)) - p * 8U;
+        uint16_t row1 = MIN(y + height, (uint16_t)(p * 8U + 8U)) - p * 8U;
+        uint8_t mask = (uint8_t)(GENMASK(row1 - 1U, row0));
+        uint8_t *row = &data->shadow[(size_t)p * config->width + x];
+
+        if (mask == 0xFFU) {
+            memset(row, set ? 0xFF : 0x00, width);
+        } else {
+            for (uint16_t i = 0; i < width; i++) {
+                row[i] = set ? (uint8_t)(row[i] | mask) : (uint8_t)(row[i] & ~mask);
+            }
+        }
+    }
+
+    /* The shadow is the source: page runs go out through the small run buffer. */
+    ch1115_mark_dirty(dev, x, page_start, (uint8_t)(page_end - page_start + 1U), width);
+    data->stats.raw_writes++;
+
+    if (data->suspended) {
+        k_mutex_unlock(&data->lock);
+        return 0;
+    }
+
+    if (data->frame_interval_ms > 0U) {
+        if (k_work_schedule(&data->flush_work, K_MSEC(data->frame_interval_ms)) == 0) {
+            data->stats.coalesced_writes++;
         }
+    } else {
+        ret = ch1115_flush_dirty(dev);
+    }
+
+    k_mutex_unlock(&data->lock);
+    ch1115_trace_write_result(ret);
+
+    return ret;
+}
+
+static int ch1115_clear(const struct device *dev)
+{
+    struct display_capabilities caps;
+
+    /* ch1115_fill() takes logical coordinates. */
+    ch1115_get_capabilities(dev, &caps);
+    return ch1115_fill(dev, 0, 0, caps.x_resolution, caps.y_resolution, false);
+}
+
+static int ch1115_init(const struct device *dev)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    int ret;
+
+    if (!i2c_is_ready_dt(&config->i2c)) {
+        LOG_ERR("I2C bus not ready");
+        return -ENODEV;
+    }
+
+    /* Intentionally no INFO logs here (keep FPS test quiet). */
+
+    if (config->reset.port) {
+        if (!gpio_is_ready_dt(&config->reset)) {
+            LOG_ERR("Reset GPIO not ready");
+            return -ENODEV;
+        }
+
+        ret = gpio_pin_configure_dt(&config->reset, GPIO_OUTPUT_INACTIVE);
+        if (ret < 0) {
+            return ret;
+        }
+
+        gpio_pin_set_dt(&config->reset, 1);
+        k_sleep(K_MSEC(10));
+        gpio_pin_set_dt(&config->reset, 0);
+        k_sleep(K_MSEC(10));
+    }
+
+    data->dev = dev;
+    data->pf = PIXEL_FORMAT_MONO01;
+	data->suspended = false;
+	data->start_line = 0U;
+	data->start_line_pending = false;
+    data->power_mode = CH1115_POWER_NORMAL;
+    data->orientation = DISPLAY_ORIENTATION_NORMAL;
+    data->mirror_x = false;
+    data->mirror_y = false;
+    data->transpose = false;
+    data->col_offset = config->segment_offset;
+    data->bus_hz = 0U;
+    data->frame_interval_ms = CONFIG_CUSTOM_OLED_DISPLAY_128X64_FRAME_INTERVAL_MS;
+    k_mutex_init(&data->lock);
+    k_work_init_delayable(&data->flush_work, ch1115_flush_work_handler);
+    memset(data->dirty_x0, 0, sizeof(data->dirty_x0));
+    memset(data->dirty_x1, 0, sizeof(data->dirty_x1));
+    data->batch_depth = 0U;
+    data->batch_len = 0U;
+    data->batch_err = 0;
+    memset(data->shadow, 0, (size_t)(config->width * config->height / 8U));
+
+    ret = ch1115_write_cmds(dev, config->init_cmds, config->init_cmds_len);
+    if (ret < 0) {
+        LOG_ERR("Failed to init CH1115 (%d)", ret);
         return ret;
-    case PM_DEVICE_ACTION_TURN_OFF:
-        /* Treat TURN_OFF as suspend for now (no external power gating). */
-        ret = ch1115_blanking_on(dev);
+    }
+
+    return 0;
+}
+
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE
+static const uint32_t ch1115_probe_rates[CH1115_BUS_PROBE_STEPS] = {
+    I2C_BITRATE_STANDARD,
+    I2C_BITRATE_FAST,
+    I2C_BITRATE_FAST_PLUS,
+};
+
+/* I2C controller speed for a bitrate, rounded down to the nearest standard speed. */
+#define CH1115_BUS_SPEED(hz)                                                                     \
+    (((hz) >= I2C_BITRATE_FAST_PLUS) ? I2C_SPEED_FAST_PLUS                                       \
+     : ((hz) >= I2C_BITRATE_FAST)    ? I2C_SPEED_FAST                                            \
+                                     : I2C_SPEED_STANDARD)
+
+/* Test pattern: differs per byte, page and frame so stuck or shifted bits show. */
+static inline uint8_t ch1115_probe_byte(uint32_t frame, uint8_t page, uint16_t x)
+{
+    return (uint8_t)(0x5A ^ (x * 7U) ^ (page * 31U) ^ (frame * 13U));
+}
+
+static enum ch1115_bus_verify ch1115_probe_verify_mode(const struct device *dev)
+{
+#if defined(CONFIG_CUSTOM_OLED_DISPLAY_128X64_EMUL)
+    const struct ch1115_config *config = dev->config;
+
+    if (config->emul != NULL) {
+        return CH1115_BUS_VERIFY_EMUL;
+    }
+#endif
+    ARG_UNUSED(dev);
+    return IS_ENABLED(CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_READBACK)
+               ? CH1115_BUS_VERIFY_READBACK
+               : CH1115_BUS_VERIFY_ACK;
+}
+
+static int ch1115_set_pos(const struct device *dev, uint8_t x, uint8_t page)
+{
+    uint8_t cmd_buf[] = {
+        (uint8_t)(0xB0 | (page & 0x0F)),
+        (uint8_t)(0x00 | (x & 0x0F)),
+        (uint8_t)(0x10 | ((x >> 4) & 0x0F)),
+    };
+
+    return ch1115_write_cmds(dev, cmd_buf, sizeof(cmd_buf));
+}
+
+/* Compare one sent page run (still in run_buf) with what the controller holds. */
+static int ch1115_probe_check_run(const struct device *dev, enum ch1115_bus_verify verify,
+                                  uint8_t page, uint8_t len)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    const uint8_t *sent = &data->run_buf[CH1115_RUN_HDR_LEN];
+    uint8_t rx[1 + CH1115_MAX_COLS];
+    int ret;
+
+    switch (verify) {
+#if defined(CONFIG_CUSTOM_OLED_DISPLAY_128X64_EMUL)
+    case CH1115_BUS_VERIFY_EMUL:
+        ret = ch1115_emul_read_gddram(config->emul, (uint8_t)(page + config->page_offset),
+                                      data->col_offset, &rx[1], len);
+        break;
+#endif
+    case CH1115_BUS_VERIFY_READBACK: {
+        const uint8_t ctrl = 0x40;
+
+        ret = ch1115_set_pos(dev, data->col_offset, (uint8_t)(page + config->page_offset));
         if (ret == 0) {
-            data->suspended = true;
+            /* The first byte of a data read is a dummy. */
+            ret = i2c_write_read_dt(&config->i2c, &ctrl, 1, rx, (size_t)len + 1U);
+        }
+        break;
+    }
+    default:
+        return 0;
+    }
+
+    if (ret < 0) {
+        return -EIO;
+    }
+
+    return (memcmp(&rx[1], sent, len) == 0) ? 0 : -EBADMSG;
+}
+
+static int ch1115_probe_rate(const struct device *dev, enum ch1115_bus_verify verify,
+                             struct ch1115_bus_probe_step *step)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    const uint32_t frames = CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_FRAMES;
+    uint64_t cycles = 0;
+    int ret;
+
+    ret = ch1115_set_bus_freq(dev, step->freq_hz);
+    if (ret < 0) {
+        return ret;
+    }
+
+    for (uint32_t f = 0; f < frames; f++) {
+        for (uint8_t p = 0; p < (uint8_t)(config->height / 8U); p++) {
+            for (uint16_t x = 0; x < config->width; x++) {
+                data->run_buf[CH1115_RUN_HDR_LEN + x] = ch1115_probe_byte(f, p, x);
+            }
+
+            uint32_t t0 = k_cycle_get_32();
+
+            ret = ch1115_send_run(dev, p, 0, (uint8_t)config->width);
+            cycles += k_cycle_get_32() - t0;
+            if (ret < 0) {
+                return -EIO;
+            }
+
+            ret = ch1115_probe_check_run(dev, verify, p, (uint8_t)config->width);
+            if (ret < 0) {
+                return ret;
+            }
+        }
+    }
+
+    uint64_t us = k_cyc_to_us_ceil64(cycles);
+
+    step->fps_x10 = (us > 0U) ? (uint32_t)(((uint64_t)frames * 10000000U) / us) : 0U;
+    return 0;
+}
+
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_SETTINGS
+static uint32_t ch1115_saved_bus_hz;
+
+static int ch1115_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+                               void *cb_arg)
+{
+    const char *next;
+
+    if (settings_name_steq(name, "bus_hz", &next) && next == NULL) {
+        if (len != sizeof(ch1115_saved_bus_hz)) {
+            return -EINVAL;
+        }
+        return MIN(read_cb(cb_arg, &ch1115_saved_bus_hz, sizeof(ch1115_saved_bus_hz)), 0);
+    }
+    return -ENOENT;
+}
+
+#define CH1115_SETTINGS_APPLY(inst)                                                              \
+    (void)ch1115_set_bus_freq(DEVICE_DT_INST_GET(inst), ch1115_saved_bus_hz);
+
+static int ch1115_settings_commit(void)
+{
+    if (ch1115_saved_bus_hz != 0U) {
+        DT_INST_FOREACH_STATUS_OKAY(CH1115_SETTINGS_APPLY)
+    }
+    return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(ch1115, "ch1115", NULL, ch1115_settings_set,
+                               ch1115_settings_commit, NULL);
+#endif /* CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_SETTINGS */
+
+int ch1115_set_bus_freq(const struct device *dev, uint32_t freq_hz)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    uint32_t speed;
+    int ret;
+
+    switch (freq_hz) {
+    case I2C_BITRATE_STANDARD:
+        speed = I2C_SPEED_STANDARD;
+        break;
+    case I2C_BITRATE_FAST:
+        speed = I2C_SPEED_FAST;
+        break;
+    case I2C_BITRATE_FAST_PLUS:
+        speed = I2C_SPEED_FAST_PLUS;
+        break;
+    default:
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    ret = i2c_configure(config->i2c.bus, I2C_MODE_CONTROLLER | I2C_SPEED_SET(speed));
+    if (ret == 0) {
+        data->bus_hz = freq_hz;
+    }
+    k_mutex_unlock(&data->lock);
+    return ret;
+}
+
+uint32_t ch1115_get_bus_freq(const struct device *dev)
+{
+    struct ch1115_data *data = dev->data;
+
+    return data->bus_hz;
+}
+
+int ch1115_bus_probe(const struct device *dev, struct ch1115_bus_probe_result *result)
+{
+    const struct ch1115_config *config = dev->config;
+    struct ch1115_data *data = dev->data;
+    int ret = 0;
+
+    if (result == NULL) {
+        return -EINVAL;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->verify = ch1115_probe_verify_mode(dev);
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    if (data->suspended) {
+        k_mutex_unlock(&data->lock);
+        return -EACCES;
+    }
+
+    /* Bus configuration to return to when no rate can be settled on. */
+    const uint32_t entry_hz = data->bus_hz;
+    uint32_t entry_cfg;
+
+    if (i2c_get_config(config->i2c.bus, &entry_cfg) < 0) {
+        entry_cfg = (entry_hz != 0U)
+                        ? (I2C_MODE_CONTROLLER | I2C_SPEED_SET(CH1115_BUS_SPEED(entry_hz)))
+                        : config->bus_dt_cfg;
+    }
+
+    for (uint8_t i = 0; i < CH1115_BUS_PROBE_STEPS; i++) {
+        struct ch1115_bus_probe_step *step = &result->steps[i];
+
+        step->freq_hz = ch1115_probe_rates[i];
+        step->err = ch1115_probe_rate(dev, result->verify, step);
+        result->steps_run++;
+        if (step->err < 0) {
+            break;
+        }
+        result->max_stable_hz = step->freq_hz;
+    }
+
+    /* Settle on the fastest stable rate, else go back to the entry config. */
+    if (result->max_stable_hz != 0U) {
+        ret = ch1115_set_bus_freq(dev, result->max_stable_hz);
+    } else {
+        ret = -EIO;
+    }
+
+    if (ret < 0) {
+        int err = i2c_configure(config->i2c.bus, entry_cfg);
+
+        if (err == 0) {
+            data->bus_hz = entry_hz;
+        } else {
+            LOG_ERR("bus config restore failed (%d)", err);
         }
+    }
+
+    /* The test frames overwrote GDDRAM: put the shown frame back either way. */
+    ch1115_mark_dirty(dev, 0, 0, (uint8_t)(config->height / 8U), config->width);
+    int err = ch1115_flush_dirty(dev);
+
+    if (ret == 0) {
+        ret = err;
+    }
+
+    k_mutex_unlock(&data->lock);
+
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE_SETTINGS
+    if (ret == 0) {
+        ch1115_saved_bus_hz = result->max_stable_hz;
+        ret = settings_save_one("ch1115/bus_hz", &ch1115_saved_bus_hz,
+                                sizeof(ch1115_saved_bus_hz));
+    }
+#endif
+
+    if (ret < 0) {
+        LOG_ERR("bus probe failed (%d)", ret);
+    }
+    return ret;
+}
+#endif /* CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE */
+
+#ifdef CONFIG_PM_DEVICE
+/* PM sequences, fixed at build time. */
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_PM_PUMP_OFF
+/* Display off first, then stop the charge pump. GDDRAM is retained. */
+static const uint8_t ch1115_pm_suspend_cmds[] = { 0xAE, CH1115_CMD_DCDC, CH1115_DCDC_OFF };
+static const uint8_t ch1115_pm_pump_on_cmds[] = { CH1115_CMD_DCDC, CH1115_DCDC_ON };
+#else
+static const uint8_t ch1115_pm_suspend_cmds[] = { 0xAE };
+#endif
+
+static int ch1115_sleep(const struct device *dev)
+{
+    struct ch1115_data *data = dev->data;
+    int ret;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    ret = ch1115_write_cmds(dev, ch1115_pm_suspend_cmds, sizeof(ch1115_pm_suspend_cmds));
+    if (ret < 0) {
+        k_mutex_unlock(&data->lock);
+        LOG_ERR("sleep failed (%d)", ret);
+        return ret;
+    }
+
+    /* A paced frame still pending is replayed on resume instead. */
+    (void)k_work_cancel_delayable(&data->flush_work);
+    data->suspended = true;
+    k_mutex_unlock(&data->lock);
+    return 0;
+}
+
+static int ch1115_wake(const struct device *dev)
+{
+    struct ch1115_data *data = dev->data;
+    int ret;
+
+#ifdef CONFIG_CUSTOM_OLED_DISPLAY_128X64_PM_PUMP_OFF
+    ret = ch1115_write_cmds(dev, ch1115_pm_pump_on_cmds, sizeof(ch1115_pm_pump_on_cmds));
+    if (ret < 0) {
+        LOG_ERR("charge pump on failed (%d)", ret);
         return ret;
+    }
+    /*
+     * Let the pump output settle before the panel is driven again. The lock
+     * is not held: still suspended, so writes keep landing in the shadow.
+     */
+    k_sleep(K_MSEC(CONFIG_CUSTOM_OLED_DISPLAY_128X64_PUMP_SETTLE_MS));
+#endif
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    /*
+     * GDDRAM survived the suspend; replay only what was drawn meanwhile so
+     * the first visible frame is current without a full redraw.
+     */
+    if (ch1115_has_dirty(dev)) {
+        ret = ch1115_flush_dirty(dev);
+        if (ret < 0) {
+            k_mutex_unlock(&data->lock);
+            LOG_ERR("resume replay failed (%d)", ret);
+            return ret;
+        }
+    }
+
+    if (data->start_line_pending) {
+        uint8_t cmd = (uint8_t)(0x40 | data->start_line);
+
+        ret = ch1115_write_cmds(dev, &cmd, 1);
+        if (ret < 0) {
+            k_mutex_unlock(&data->lock);
+            LOG_ERR("resume start line failed (%d)", ret);
+            return ret;
+        }
+        data->start_line_pending = false;
+    }
+
+    ret = ch1115_blanking_off(dev);
+    if (ret == 0) {
+        data->suspended = false;
+    }
+    k_mutex_unlock(&data->lock);
+    return ret;
+}
+
+static int ch1115_pm_action(const struct device *dev, enum pm_device_action action)
+{
+    switch (action) {
+    case PM_DEVICE_ACTION_SUSPEND:
+        return ch1115_sleep(dev);
+    case PM_DEVICE_ACTION_RESUME:
+        return ch1115_wake(dev);
+    case PM_DEVICE_ACTION_TURN_OFF:
+        /* Treat TURN_OFF as suspend for now (no external power gating). */
+        return ch1115_sleep(dev);
     default:
         return -ENOTSUP;
     }
@@ -386,10 +1491,16 @@ static const struct display_driver_api ch1115_driver_api = {
     .get_capabilities = ch1115_get_capabilities,
     .set_pixel_format = ch1115_set_pixel_format,
     .set_contrast = ch1115_set_contrast,
+    .set_orientation = ch1115_set_orientation,
 };
 
 #define CH1115_DEVICE(inst)                                                                      \
-    static struct ch1115_data ch1115_data_##inst;                                              \
+    static const uint8_t ch1115_init_cmds_##inst[] = CH1115_INIT_CMDS(inst);                  \
+    static uint8_t ch1115_shadow_##inst[DT_INST_PROP(inst, width) *                            \
+                                        DT_INST_PROP(inst, height) / 8];                       \
+    static struct ch1115_data ch1115_data_##inst = {                                           \
+        .shadow = ch1115_shadow_##inst,                                                        \
+    };                                                                                         \
     static const struct ch1115_config ch1115_config_##inst = {                                 \
         .i2c = I2C_DT_SPEC_INST_GET(inst),                                                    \
         .reset = GPIO_DT_SPEC_INST_GET_OR(inst, reset_gpios, {0}),                           \
@@ -402,6 +1513,16 @@ static const struct display_driver_api ch1115_driver_api = {
         .prechargep = DT_INST_PROP_OR(inst, prechargep, 0x22),                               \
         .segment_remap = DT_INST_PROP_OR(inst, segment_remap, 0),                            \
         .com_invdir = DT_INST_PROP_OR(inst, com_invdir, 0),                                  \
+        .column_scroll = DT_INST_PROP(inst, column_scroll),                                  \
+        IF_ENABLED(CONFIG_CUSTOM_OLED_DISPLAY_128X64_BUS_PROBE,                                \
+                   (.bus_dt_cfg = I2C_MODE_CONTROLLER |                                        \
+                                  I2C_SPEED_SET(CH1115_BUS_SPEED(DT_PROP_OR(                   \
+                                      DT_INST_BUS(inst), clock_frequency,                      \
+                                      I2C_BITRATE_STANDARD))),))                               \
+        .init_cmds = ch1115_init_cmds_##inst,                                                  \
+        .init_cmds_len = sizeof(ch1115_init_cmds_##inst),                                      \
+        IF_ENABLED(CONFIG_CUSTOM_OLED_DISPLAY_128X64_EMUL,                                     \
+                   (.emul = EMUL_DT_GET(DT_DRV_INST(inst)),))                                  \
     };                                                                                         \
 	PM_DEVICE_DT_INST_DEFINE(inst, ch1115_pm_action);                                          \
     DEVICE_DT_INST_DEFINE(inst, ch1115_init, PM_DEVICE_DT_INST_GET(inst),                    \
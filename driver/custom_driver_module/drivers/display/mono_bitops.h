@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 1bpp bit kernels shared by the mono display paths.
+ *
+ * An 8x8 block is eight bytes b[0..7]; bit j of b[i] is element (i, j).
+ * For a VTILED page that is eight columns, bit j = row j of the page.
+ */
+
+/** Reverse the bit order of one byte (row j <-> row 7 - j in a VTILED byte). */
+static inline uint8_t mono_bitrev8(uint8_t v)
+{
+	v = (uint8_t)(((v & 0xF0U) >> 4) | ((v & 0x0FU) << 4));
+	v = (uint8_t)(((v & 0xCCU) >> 2) | ((v & 0x33U) << 2));
+	v = (uint8_t)(((v & 0xAAU) >> 1) | ((v & 0x55U) << 1));
+	return v;
+}
+
+/** Bit-reverse every byte of a 64-bit word in parallel. */
+static inline uint64_t mono_bitrev8x8(uint64_t x)
+{
+	x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+	x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+	x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+	return x;
+}
+
+static inline uint64_t mono_load8x8(const uint8_t *b, uint32_t stride)
+{
+	uint64_t x = 0;
+
+	for (uint32_t i = 0; i < 8U; i++) {
+		x |= (uint64_t)b[i * stride] << (8U * i);
+	}
+	return x;
+}
+
+static inline void mono_store8x8(uint8_t *b, uint32_t stride, uint64_t x)
+{
+	for (uint32_t i = 0; i < 8U; i++) {
+		b[i * stride] = (uint8_t)(x >> (8U * i));
+	}
+}
+
+/**
+ * Transpose an 8x8 bit block held in a word (byte i = b[i]): element (i, j)
+ * moves to (j, i). Three swap stages of 1, 2 and 4 bit distance instead of
+ * 64 single-bit moves.
+ */
+static inline uint64_t mono_transpose8x8(uint64_t x)
+{
+	uint64_t t;
+
+	t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+	x ^= t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+	x ^= t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+	x ^= t ^ (t << 28);
+	return x;
+}
+
+/** VTILED byte for column x of an I1 bitmap, built from rows y0..y0+rows-1. */
+static inline uint8_t mono_i1_column(const uint8_t *src, uint32_t src_stride, uint32_t x,
+				     uint32_t y0, uint32_t rows, uint8_t invert)
+{
+	const uint8_t *s = &src[y0 * src_stride + x / 8U];
+	uint8_t mask = (uint8_t)(0x80U >> (x & 7U));
+	uint8_t v = 0;
+
+	for (uint32_t j = 0; j < rows; j++) {
+		if (((s[j * src_stride] & mask) != 0U) ^ (invert != 0U)) {
+			v |= (uint8_t)(1U << j);
+		}
+	}
+	return v;
+}
+
+/**
+ * Convert a row-major, MSB-first 1bpp bitmap (LVGL I1 pixels, palette
+ * skipped) of w x h to VTILED: dst gets ceil(h/8) pages of w bytes, bit j
+ * of a byte is row 8*page + j. Whole 8x8 blocks are bit-reversed and
+ * transposed as one 64-bit word; only the right and bottom edges go pixel
+ * by pixel. Rows past h in the last page are left 0. invert flips every
+ * pixel (PIXEL_FORMAT_MONO10).
+ */
+static inline void mono_i1_to_vtiled(uint8_t *dst, const uint8_t *src, uint32_t w, uint32_t h,
+				     uint32_t src_stride, bool invert)
+{
+	const uint64_t inv = invert ? ~0ULL : 0ULL;
+	const uint32_t full_pages = h / 8U;
+	const uint32_t full_groups = w / 8U;
+
+	for (uint32_t p = 0; p < full_pages; p++) {
+		const uint8_t *s = &src[p * 8U * src_stride];
+		uint8_t *d = &dst[p * w];
+
+		for (uint32_t g = 0; g < full_groups; g++) {
+			/* Byte i = row i, MSB = left column; reverse so bit j = column j. */
+			uint64_t blk = mono_bitrev8x8(mono_load8x8(&s[g], src_stride) ^ inv);
+
+			mono_store8x8(&d[g * 8U], 1, mono_transpose8x8(blk));
+		}
+		for (uint32_t x = full_groups * 8U; x < w; x++) {
+			d[x] = mono_i1_column(src, src_stride, x, p * 8U, 8U, invert);
+		}
+	}
+
+	if ((h & 7U) != 0U) {
+		uint8_t *d = &dst[full_pages * w];
+
+		for (uint32_t x = 0; x < w; x++) {
+			d[x] = mono_i1_column(src, src_stride, x, full_pages * 8U, h & 7U, invert);
+		}
+	}
+}
+
+#ifdef __cplusplus
+}
+#endif
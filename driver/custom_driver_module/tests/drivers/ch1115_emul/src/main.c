@@ -0,0 +1,164 @@
+/*
+ * CH1115 driver against its I2C emulator: what display_write(), the column
+ * scroll, the mirror setters and display_set_orientation() put on the bus
+ * must show up on the emulated panel (ch1115_emul_get_frame()).
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+#include "display/ch1115.h"
+#include "display/ch1115_emul.h"
+
+#define OLED_NODE DT_NODELABEL(oled)
+#define WIDTH	  DT_PROP(OLED_NODE, width)
+#define HEIGHT	  DT_PROP(OLED_NODE, height)
+#define FRAME_LEN (WIDTH * HEIGHT / 8)
+
+static const struct device *const dev = DEVICE_DT_GET(OLED_NODE);
+static const struct emul *const emul = EMUL_DT_GET(OLED_NODE);
+
+static uint8_t pattern[FRAME_LEN];
+static uint8_t expected[FRAME_LEN];
+static uint8_t frame[FRAME_LEN];
+
+static bool pixel(const uint8_t *buf, uint16_t x, uint16_t y)
+{
+	return (buf[(y / 8U) * WIDTH + x] >> (y % 8U)) & 0x1U;
+}
+
+/* The pattern as the panel shows it with the given axes flipped. */
+static void expect_flipped(bool flip_x, bool flip_y)
+{
+	memset(expected, 0, sizeof(expected));
+	for (uint16_t y = 0; y < HEIGHT; y++) {
+		for (uint16_t x = 0; x < WIDTH; x++) {
+			uint16_t sx = flip_x ? (WIDTH - 1U - x) : x;
+			uint16_t sy = flip_y ? (HEIGHT - 1U - y) : y;
+
+			if (pixel(pattern, sx, sy)) {
+				expected[(y / 8U) * WIDTH + x] |= (uint8_t)BIT(y % 8U);
+			}
+		}
+	}
+}
+
+static void write_pattern(void)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pattern),
+		.width = WIDTH,
+		.height = HEIGHT,
+		.pitch = WIDTH,
+	};
+
+	zassert_ok(display_write(dev, 0, 0, &desc, pattern));
+}
+
+static void check_frame(void)
+{
+	zassert_ok(ch1115_emul_get_frame(emul, frame, sizeof(frame)));
+	zassert_mem_equal(frame, expected, sizeof(frame));
+}
+
+static void *ch1115_emul_setup(void)
+{
+	zassert_true(device_is_ready(dev), "CH1115 not ready");
+
+	/* Asymmetric in both axes: any column shift or flip changes the frame. */
+	for (size_t i = 0; i < sizeof(pattern); i++) {
+		pattern[i] = (uint8_t)(i * 37U + i / WIDTH + 1U);
+	}
+
+	return NULL;
+}
+
+static void ch1115_emul_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(display_set_orientation(dev, DISPLAY_ORIENTATION_NORMAL));
+	zassert_ok(ch1115_set_mirror(dev, false, false));
+	write_pattern();
+}
+
+ZTEST(ch1115_emul, test_write)
+{
+	expect_flipped(false, false);
+	check_frame();
+}
+
+ZTEST(ch1115_emul, test_write_partial)
+{
+	static const uint8_t block[2 * 16] = {
+		0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+		0x00, 0x3C, 0x42, 0x81, 0x81, 0x42, 0x3C, 0x00,
+		0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+		0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
+	};
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(block),
+		.width = 16,
+		.height = 16,
+		.pitch = 16,
+	};
+	const uint16_t x = 20;
+	const uint16_t page = 2;
+
+	zassert_ok(display_write(dev, x, page * 8U, &desc, block));
+
+	expect_flipped(false, false);
+	memcpy(&expected[page * WIDTH + x], &block[0], 16);
+	memcpy(&expected[(page + 1U) * WIDTH + x], &block[16], 16);
+	check_frame();
+}
+
+ZTEST(ch1115_emul, test_scroll_left)
+{
+	/* Pages 1 and 2 rotate by one column; the others stay put. */
+	zassert_ok(ch1115_scroll(dev, CH1115_SCROLL_LEFT, 8, 16));
+
+	expect_flipped(false, false);
+	for (uint16_t p = 1; p <= 2; p++) {
+		for (uint16_t x = 0; x < WIDTH; x++) {
+			expected[p * WIDTH + x] = pattern[p * WIDTH + (x + 1U) % WIDTH];
+		}
+	}
+	check_frame();
+}
+
+ZTEST(ch1115_emul, test_mirror)
+{
+	zassert_ok(ch1115_set_mirror(dev, true, false));
+	expect_flipped(true, false);
+	check_frame();
+
+	zassert_ok(ch1115_set_mirror(dev, false, true));
+	expect_flipped(false, true);
+	check_frame();
+
+	/* Writes after the change land at the mirrored position too. */
+	zassert_ok(ch1115_set_mirror(dev, true, true));
+	write_pattern();
+	expect_flipped(true, true);
+	check_frame();
+}
+
+ZTEST(ch1115_emul, test_orientation_180)
+{
+	struct display_capabilities caps;
+
+	zassert_ok(display_set_orientation(dev, DISPLAY_ORIENTATION_ROTATED_180));
+	display_get_capabilities(dev, &caps);
+	zassert_equal(caps.current_orientation, DISPLAY_ORIENTATION_ROTATED_180);
+	zassert_equal(caps.x_resolution, WIDTH);
+
+	expect_flipped(true, true);
+	check_frame();
+}
+
+ZTEST_SUITE(ch1115_emul, NULL, ch1115_emul_setup, ch1115_emul_before, NULL, NULL);
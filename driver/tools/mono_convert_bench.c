@@ -0,0 +1,149 @@
+/*
+ * Host microbenchmark: LVGL I1 -> CH1115 VTILED conversion of one 88x48
+ * frame, stock per-pixel loop vs mono_i1_to_vtiled() (display/mono_bitops.h).
+ *
+ * Build and run from driver/ (a C99 compiler on a POSIX host):
+ *   cc -O2 -I custom_driver_module/drivers tools/mono_convert_bench.c -o mono_convert_bench
+ *   ./mono_convert_bench [frames]
+ *
+ * The stock path mirrors Zephyr's lvgl_display_mono.c: one bit test and one
+ * read-modify-write of the destination byte per pixel. Both outputs are
+ * compared on every test pattern before timing. Reports ns per frame, plus
+ * TSC cycles per frame on x86.
+ */
+
+/* clock_gettime() and CLOCK_MONOTONIC are POSIX, not C99. */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include "display/mono_bitops.h"
+
+#define FRAME_W 88U
+#define FRAME_H 48U
+#define SRC_STRIDE ((FRAME_W + 7U) / 8U)
+#define VT_BYTES (FRAME_W * ((FRAME_H + 7U) / 8U))
+
+static void stock_i1_to_vtiled(uint8_t *dst, const uint8_t *src, uint32_t w, uint32_t h,
+			       uint32_t src_stride, bool invert)
+{
+	memset(dst, 0, (size_t)w * ((h + 7U) / 8U));
+	for (uint32_t y = 0; y < h; y++) {
+		for (uint32_t x = 0; x < w; x++) {
+			bool lit = (src[y * src_stride + x / 8U] & (0x80U >> (x & 7U))) != 0U;
+
+			if (lit ^ invert) {
+				dst[(y / 8U) * w + x] |= (uint8_t)(1U << (y & 7U));
+			} else {
+				dst[(y / 8U) * w + x] &= (uint8_t)~(1U << (y & 7U));
+			}
+		}
+	}
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t now_cycles(void)
+{
+#ifdef HAVE_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/* Check both paths on odd sizes too, so the edge fallbacks are covered. */
+static int verify(void)
+{
+	static const uint32_t sizes[][2] = { { 88, 48 }, { 88, 24 }, { 8, 8 }, { 13, 11 }, { 1, 1 } };
+	uint8_t src[SRC_STRIDE * FRAME_H];
+	uint8_t a[VT_BYTES];
+	uint8_t b[VT_BYTES];
+
+	srand(1);
+	for (size_t n = 0; n < sizeof(sizes) / sizeof(sizes[0]); n++) {
+		uint32_t w = sizes[n][0];
+		uint32_t h = sizes[n][1];
+		uint32_t stride = (w + 7U) / 8U;
+
+		for (int inv = 0; inv < 2; inv++) {
+			for (size_t i = 0; i < sizeof(src); i++) {
+				src[i] = (uint8_t)rand();
+			}
+			stock_i1_to_vtiled(a, src, w, h, stride, inv);
+			memset(b, 0xA5, sizeof(b));
+			mono_i1_to_vtiled(b, src, w, h, stride, inv);
+			if (memcmp(a, b, (size_t)w * ((h + 7U) / 8U)) != 0) {
+				fprintf(stderr, "mismatch at %ux%u invert=%d\n", w, h, inv);
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+typedef void (*convert_fn)(uint8_t *, const uint8_t *, uint32_t, uint32_t, uint32_t, bool);
+
+static void bench(const char *name, convert_fn fn, const uint8_t *src, uint32_t frames)
+{
+	static uint8_t dst[VT_BYTES];
+	volatile uint8_t sink = 0;
+	uint64_t t0 = now_ns();
+	uint64_t c0 = now_cycles();
+
+	for (uint32_t i = 0; i < frames; i++) {
+		fn(dst, src, FRAME_W, FRAME_H, SRC_STRIDE, (i & 1U) != 0U);
+		sink ^= dst[i % VT_BYTES];
+	}
+
+	uint64_t cycles = now_cycles() - c0;
+	uint64_t ns = now_ns() - t0;
+
+	(void)sink;
+	printf("%-8s %8.1f ns/frame", name, (double)ns / frames);
+#ifdef HAVE_TSC
+	printf(" %9.1f cycles/frame", (double)cycles / frames);
+#else
+	(void)cycles;
+#endif
+	printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t frames = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 200000U;
+	uint8_t src[SRC_STRIDE * FRAME_H];
+
+	if (frames == 0U) {
+		frames = 1U;
+	}
+
+	if (verify() != 0) {
+		return 1;
+	}
+
+	for (size_t i = 0; i < sizeof(src); i++) {
+		src[i] = (uint8_t)(i * 37U + 11U);
+	}
+
+	printf("%ux%u I1 -> VTILED, %u frames\n", FRAME_W, FRAME_H, frames);
+	bench("stock", stock_i1_to_vtiled, src, frames);
+	bench("8x8", mono_i1_to_vtiled, src, frames);
+	return 0;
+}
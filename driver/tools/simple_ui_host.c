@@ -0,0 +1,308 @@
+/*
+ * Host build of the simple_ui renderer core (app/simple_ui_render.c): dump
+ * every scene as PBM frames and time the renderer, without the board or
+ * the OLED.
+ *
+ * Build and run from driver/ (Python 3 and a C99 compiler on a POSIX host):
+ *   mkdir -p build-host
+ *   python3 app/tools/gen_font5x7_header.py --scan app/simple_ui_render.c \
+ *       --chars "0123456789:" build-host/font5x7.h
+ *   cc -O2 -I app -I build-host tools/simple_ui_host.c app/simple_ui_render.c \
+ *       -o build-host/simple_ui_host
+ *   ./build-host/simple_ui_host check tools/golden/simple_ui
+ *   ./build-host/simple_ui_host dump <dir>
+ *   ./build-host/simple_ui_host bench [frames]
+ *
+ * The frames are info.pbm, qr.pbm and rec_v001.pbm .. rec_v100.pbm (the
+ * recording scene at every volume, same animation state), as the panel
+ * shows them: lit pixels white.
+ *
+ * check renders every frame and compares it byte for byte with the golden
+ * file of the same name in <dir>; it stops at the first difference and
+ * exits non-zero. dump writes the frames to <dir>. After an intended
+ * rendering change, regenerate the goldens with
+ *   ./build-host/simple_ui_host dump tools/golden/simple_ui
+ * and commit them together with the change.
+ *
+ * bench reports ns per frame (and TSC cycles on x86) for full renders of
+ * each scene and for one recording scroll tick: ui_rec_anim_step() plus
+ * the incremental ui_render_rec_scroll().
+ *
+ * Both commands first play a recording run with volume changes and check
+ * every incremental frame against a full render.
+ */
+
+/* clock_gettime() and CLOCK_MONOTONIC are POSIX, not C99. */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include "simple_ui_render.h"
+
+#define PBM_STRIDE ((OLED_WIDTH + 7) / 8)
+#define PBM_MAX     (32 + PBM_STRIDE * OLED_HEIGHT)
+
+/* Enough ticks to fill the screen with bars before a frame is dumped. */
+#define REC_WARMUP_TICKS (2 * OLED_WIDTH)
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t now_cycles(void)
+{
+#ifdef HAVE_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static void rec_warmup(void)
+{
+	ui_rec_anim_reset();
+	for (int i = 0; i < REC_WARMUP_TICKS; i++) {
+		ui_rec_anim_step();
+	}
+}
+
+/* Incremental scroll frames must equal a full render of the same state. */
+static int verify(void)
+{
+	static struct ui_frame inc;
+	static struct ui_frame full;
+	struct ui_col_span spans[UI_REC_SCROLL_MAX_SPANS];
+	uint8_t volume = 50;
+
+	ui_rec_anim_reset();
+	ui_render_scene(&inc, SCENE_START_RECORDING, volume);
+
+	for (int tick = 0; tick < 10000; tick++) {
+		if (tick % 97 == 0) {
+			volume = (uint8_t)(REC_VOLUME_MIN + (tick * 37) % REC_VOLUME_MAX);
+		}
+		if (tick % 2500 == 2499) {
+			ui_render_scene(&inc, SCENE_QR, volume);
+		}
+
+		ui_rec_anim_step();
+		ui_render_rec_scroll(&inc, volume, spans);
+		ui_render_scene(&full, SCENE_START_RECORDING, volume);
+
+		if (memcmp(inc.buf, full.buf, OLED_BUF_SIZE) != 0) {
+			fprintf(stderr, "incremental frame differs at tick %d, volume %u\n", tick,
+				volume);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static size_t encode_pbm(const struct ui_frame *f, uint8_t *out)
+{
+	size_t n = (size_t)snprintf((char *)out, PBM_MAX, "P4\n%d %d\n", OLED_WIDTH, OLED_HEIGHT);
+	uint8_t *row = out + n;
+
+	memset(row, 0, PBM_STRIDE * OLED_HEIGHT);
+	for (int y = 0; y < OLED_HEIGHT; y++, row += PBM_STRIDE) {
+		for (int x = 0; x < OLED_WIDTH; x++) {
+			bool lit = (f->buf[(y / 8) * OLED_WIDTH + x] >> (y & 7)) & 1U;
+
+			/* PBM 1 = black: unlit OLED pixels are black. */
+			if (!lit) {
+				row[x / 8] |= (uint8_t)(0x80U >> (x & 7));
+			}
+		}
+	}
+	return n + PBM_STRIDE * OLED_HEIGHT;
+}
+
+static int write_pbm(const char *path, const uint8_t *pbm, size_t len)
+{
+	FILE *fp = fopen(path, "wb");
+
+	if (!fp) {
+		perror(path);
+		return -1;
+	}
+	fwrite(pbm, 1, len, fp);
+	if (fclose(fp) != 0) {
+		perror(path);
+		return -1;
+	}
+	return 0;
+}
+
+static int check_pbm(const char *path, const uint8_t *pbm, size_t len)
+{
+	uint8_t golden[PBM_MAX + 1];
+	FILE *fp = fopen(path, "rb");
+	size_t n;
+
+	if (!fp) {
+		perror(path);
+		return -1;
+	}
+	n = fread(golden, 1, sizeof(golden), fp);
+	fclose(fp);
+
+	if (n != len || memcmp(golden, pbm, len) != 0) {
+		fprintf(stderr, "%s: rendered frame differs from golden\n", path);
+		return -1;
+	}
+	return 0;
+}
+
+/* Render every golden frame and hand it to write_pbm() or check_pbm(). */
+static int frames(const char *dir, int (*fn)(const char *, const uint8_t *, size_t))
+{
+	static struct ui_frame f;
+	uint8_t pbm[PBM_MAX];
+	char path[512];
+	int n = 0;
+
+	ui_render_scene(&f, SCENE_INFO, REC_VOLUME_MIN);
+	snprintf(path, sizeof(path), "%s/info.pbm", dir);
+	if (fn(path, pbm, encode_pbm(&f, pbm)) < 0) {
+		return -1;
+	}
+	n++;
+
+	ui_render_scene(&f, SCENE_QR, REC_VOLUME_MIN);
+	snprintf(path, sizeof(path), "%s/qr.pbm", dir);
+	if (fn(path, pbm, encode_pbm(&f, pbm)) < 0) {
+		return -1;
+	}
+	n++;
+
+	rec_warmup();
+	for (int v = REC_VOLUME_MIN; v <= REC_VOLUME_MAX; v++) {
+		ui_render_scene(&f, SCENE_START_RECORDING, (uint8_t)v);
+		snprintf(path, sizeof(path), "%s/rec_v%03d.pbm", dir, v);
+		if (fn(path, pbm, encode_pbm(&f, pbm)) < 0) {
+			return -1;
+		}
+		n++;
+	}
+
+	return n;
+}
+
+static void report(const char *name, uint64_t ns, uint64_t cycles, uint32_t frames)
+{
+	printf("%-12s %8.1f ns/frame", name, (double)ns / frames);
+#ifdef HAVE_TSC
+	printf(" %9.1f cycles/frame", (double)cycles / frames);
+#else
+	(void)cycles;
+#endif
+	printf("\n");
+}
+
+static void bench_scene(const char *name, enum ui_scene scene, uint32_t frames)
+{
+	static struct ui_frame f;
+	volatile uint8_t sink = 0;
+	uint64_t t0 = now_ns();
+	uint64_t c0 = now_cycles();
+
+	for (uint32_t i = 0; i < frames; i++) {
+		ui_render_scene(&f, scene, 60);
+		sink ^= f.buf[i % OLED_BUF_SIZE];
+	}
+
+	uint64_t cycles = now_cycles() - c0;
+	uint64_t ns = now_ns() - t0;
+
+	(void)sink;
+	report(name, ns, cycles, frames);
+}
+
+static void bench_rec_scroll(uint32_t frames)
+{
+	static struct ui_frame f;
+	struct ui_col_span spans[UI_REC_SCROLL_MAX_SPANS];
+	volatile uint8_t sink = 0;
+
+	rec_warmup();
+	ui_render_scene(&f, SCENE_START_RECORDING, 60);
+
+	uint64_t t0 = now_ns();
+	uint64_t c0 = now_cycles();
+
+	for (uint32_t i = 0; i < frames; i++) {
+		ui_rec_anim_step();
+		sink ^= (uint8_t)ui_render_rec_scroll(&f, 60, spans);
+	}
+
+	uint64_t cycles = now_cycles() - c0;
+	uint64_t ns = now_ns() - t0;
+
+	(void)sink;
+	report("rec scroll", ns, cycles, frames);
+}
+
+static int bench(uint32_t frames)
+{
+	printf("%dx%d simple_ui render, %u frames\n", OLED_WIDTH, OLED_HEIGHT, frames);
+	bench_scene("info", SCENE_INFO, frames);
+	bench_scene("qr", SCENE_QR, frames);
+	rec_warmup();
+	bench_scene("rec full", SCENE_START_RECORDING, frames);
+	bench_rec_scroll(frames);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 2 ||
+	    ((strcmp(argv[1], "dump") == 0 || strcmp(argv[1], "check") == 0) && argc != 3)) {
+		fprintf(stderr, "usage: %s check <dir> | dump <dir> | bench [frames]\n", argv[0]);
+		return 2;
+	}
+
+	if (verify() != 0) {
+		return 1;
+	}
+
+	if (strcmp(argv[1], "dump") == 0) {
+		int n = frames(argv[2], write_pbm);
+
+		if (n < 0) {
+			return 1;
+		}
+		printf("wrote %d frames to %s\n", n, argv[2]);
+		return 0;
+	}
+	if (strcmp(argv[1], "check") == 0) {
+		int n = frames(argv[2], check_pbm);
+
+		if (n < 0) {
+			return 1;
+		}
+		printf("%d frames match %s\n", n, argv[2]);
+		return 0;
+	}
+	if (strcmp(argv[1], "bench") == 0) {
+		uint32_t frames = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 200000U;
+
+		return bench((frames == 0U) ? 1U : frames);
+	}
+
+	fprintf(stderr, "unknown command: %s\n", argv[1]);
+	return 2;
+}